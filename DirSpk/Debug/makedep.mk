@@ -86,3 +86,33 @@ src\ui.c
 
 src\util.c
 
+src\synth.c
+
+src\player.c
+
+src\clip.c
+
+src\clips.c
+
+src\siggen.c
+
+src\capture.c
+
+src\measure.c
+
+src\chain.c
+
+src\spectrum.c
+
+src\notes.c
+
+src\tune.c
+
+src\flash.c
+
+src\store.c
+
+src\upload.c
+
+src\library.c
+
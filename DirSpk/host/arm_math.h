@@ -0,0 +1,14 @@
+// arm_math.h
+//
+// Host stand-in for the CMSIS DSP types used in decls.h
+
+#ifndef HOST_ARM_MATH_H_
+#define HOST_ARM_MATH_H_
+
+#include <stdint.h>
+
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+typedef float float32_t;
+
+#endif /* HOST_ARM_MATH_H_ */
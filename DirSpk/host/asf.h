@@ -0,0 +1,88 @@
+// asf.h
+//
+// Host stand-in for the ASF, FreeRTOS and CMSIS declarations that decls.h
+// and the encoder code need, so encoder.c can be built and run on Linux.
+// Registers are plain variables that the harness writes.
+
+#ifndef HOST_ASF_H_
+#define HOST_ASF_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+//
+// FreeRTOS
+//
+
+typedef uint32_t portTickType;
+typedef long portBASE_TYPE;
+typedef void *xQueueHandle;
+typedef void *xSemaphoreHandle;
+typedef void *xTimerHandle;
+typedef void *xTaskHandle;
+
+#define portTICK_RATE_MS 1
+#define pdFALSE 0
+#define pdTRUE 1
+
+extern xQueueHandle xQueueCreate(unsigned length, unsigned itemSize);
+extern portBASE_TYPE xQueueSendToBackFromISR(xQueueHandle q, void const *item,
+	portBASE_TYPE *taskWoken);
+extern void vPortYieldFromISR(void);
+
+// ASF FreeRTOS peripheral control
+typedef void *freertos_uart_if;
+
+//
+// Registers
+//
+
+typedef volatile uint32_t RW;
+
+typedef struct {
+	RW PIO_PDSR;
+	RW PIO_ISR;
+} Pio;
+extern Pio *PIOC;
+
+typedef struct {
+	RW CTRL;
+	RW CYCCNT;
+} DWT_Type;
+extern DWT_Type *DWT;
+
+// Interrupts. The harness calls the PIOC handler itself.
+typedef int IRQn_Type;
+#define ID_PIOC 13
+static inline void NVIC_DisableIRQ(IRQn_Type irq) {
+}
+static inline void NVIC_EnableIRQ(IRQn_Type irq) {
+}
+
+// Flash bank 1
+#define IFLASH1_PAGE_SIZE 256
+
+//
+// CMSIS intrinsics. The harness is single threaded, so exclusive
+// stores always succeed.
+//
+
+static inline uint32_t __LDREXW(volatile uint32_t *p) {
+	return *p;
+}
+
+static inline uint32_t __STREXW(uint32_t v, volatile uint32_t *p) {
+	*p = v;
+	return 0;
+}
+
+//
+// ASF utilities
+//
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+
+#endif /* HOST_ASF_H_ */
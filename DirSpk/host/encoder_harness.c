@@ -0,0 +1,479 @@
+// encoder_harness.c
+//
+// Runs the encoder interrupt handler (encoder.c) on the host. Replays
+// recorded signal traces, or generates random bouncy ones, and reports the
+// moves detected, any false or missed moves, and edges handled per second.
+//
+//   encoder_harness [-s seed] [-n detents] [-b bounces] [-r reverse%] [-a abort%] [-x] [-w file] [-c file]
+//   encoder_harness [-c file] file ...
+//
+// With no files, a trace is generated for encoder 0 (type A) and encoder 2
+// (type B), or the other way round with -x. Each starts with a few detents
+// that rest long enough for the detent type to be detected. Then each
+// detent may reverse direction, or be aborted half way, and every
+// transition may bounce. -w writes the trace out for replay. -c captures
+// pin snapshots while replaying and writes them as the et command dumps
+// them, for src/scripts/edges.py.
+//
+// A trace file has one line per edge: time in us, encoder 0-3, and that
+// encoder's signals 0-3. It may also list the moves expected:
+//   m start_us end_us encoder dir
+// where dir is 1 (CW) or 2 (CCW), and the move must be detected at or after
+// start and before end. Moves are only scored if the trace lists them, and
+// moves before the first one expected are not scored.
+// Lines starting with # are comments.
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "decls.h"
+
+//
+// Stand-ins for the firmware
+//
+
+static Pio pioc;
+Pio *PIOC = &pioc;
+static DWT_Type dwt;
+DWT_Type *DWT = &dwt;
+
+// Normally in ui.c
+xQueueHandle uiQueue = &uiQueue;
+volatile bool uiQueueFullFlag;
+
+// Time of the edge being replayed. DWT->CYCCNT wraps every 51 seconds,
+// so moves are timed with this instead.
+static uint32_t edgeUs;
+
+// Moves seen on the debug queue, and UI wake-ups
+typedef struct {
+	EncoderMove move;
+	uint32_t us;
+} Move;
+static Move *moves;
+static size_t numMoves, movesCap;
+static uint32_t wakeUps;
+
+xQueueHandle xQueueCreate(unsigned length, unsigned itemSize) {
+	static int queues;
+	return &queues;
+}
+
+portBASE_TYPE xQueueSendToBackFromISR(xQueueHandle q, void const *item,
+		portBASE_TYPE *taskWoken) {
+	if (q == uiQueue) {
+		wakeUps++;
+		// The UI would take the moves at once
+		int32_t d[NUM_ENCODERS], a[NUM_ENCODERS];
+		encoderTake(d, a);
+	} else {
+		if (numMoves == movesCap) {
+			movesCap = movesCap ? movesCap * 2 : 1024;
+			moves = realloc(moves, movesCap * sizeof(*moves));
+		}
+		moves[numMoves++] = (Move) {*(EncoderMove const *) item, edgeUs};
+	}
+	return pdTRUE;
+}
+
+void vPortYieldFromISR(void) {
+}
+
+// An erased settings page, so detent types are detected
+static uint32_t flashPage[FLASH_PAGE_SIZE / 4] = {0xffffffff, 0xffffffff};
+
+uint8_t const *flashStoreAddress(uint32_t offset) {
+	return (uint8_t const *) flashPage;
+}
+
+bool flashStoreLock(portTickType wait) {
+	return true;
+}
+
+void flashStoreUnlock(void) {
+}
+
+bool flashStoreWrite(uint32_t offset, void const *data) {
+	memcpy(flashPage, data, sizeof(flashPage));
+	return true;
+}
+
+bool playerIsPlaying(void) {
+	return false;
+}
+
+bool clipIsPlaying(void) {
+	return false;
+}
+
+//
+// Traces
+//
+
+typedef struct {
+	uint32_t us;
+	uint8_t num;
+	EncoderSignals signals;
+} Edge;
+
+typedef struct {
+	uint32_t start, end;
+	uint8_t num;
+	EncoderDirection dir;
+} Expected;
+
+typedef struct {
+	Edge *edges;
+	size_t numEdges, edgesCap;
+	Expected *expected;
+	size_t numExpected, expectedCap;
+} Trace;
+
+static void addEdge(Trace *t, uint32_t us, int num, EncoderSignals signals) {
+	if (t->numEdges == t->edgesCap) {
+		t->edgesCap = t->edgesCap ? t->edgesCap * 2 : 4096;
+		t->edges = realloc(t->edges, t->edgesCap * sizeof(Edge));
+	}
+	t->edges[t->numEdges++] = (Edge) {us, num, signals};
+}
+
+static void addExpected(Trace *t, uint32_t start, uint32_t end, int num, EncoderDirection dir) {
+	if (t->numExpected == t->expectedCap) {
+		t->expectedCap = t->expectedCap ? t->expectedCap * 2 : 1024;
+		t->expected = realloc(t->expected, t->expectedCap * sizeof(Expected));
+	}
+	t->expected[t->numExpected++] = (Expected) {start, end, num, dir};
+}
+
+// Read a trace file. Returns false if it cannot be read.
+static bool readTrace(Trace *t, char const *name) {
+	FILE *f = fopen(name, "r");
+	if (!f) {
+		fprintf(stderr, "%s: %s\n", name, strerror(errno));
+		return false;
+	}
+	char line[128];
+	int lineNum = 0;
+	while (fgets(line, sizeof(line), f)) {
+		lineNum++;
+		unsigned long us, end;
+		unsigned num, value;
+		if (line[0] == '#' || line[0] == '\n') {
+			continue;
+		} else if (sscanf(line, "m %lu %lu %u %u", &us, &end, &num, &value) == 4 &&
+				num < NUM_ENCODERS && (value == ENC_CW || value == ENC_CCW)) {
+			addExpected(t, us, end, num, value);
+		} else if (sscanf(line, "%lu %u %u", &us, &num, &value) == 3 &&
+				num < NUM_ENCODERS && value < 4) {
+			addEdge(t, us, num, value);
+		} else {
+			fprintf(stderr, "%s:%d: not an edge or move\n", name, lineNum);
+			fclose(f);
+			return false;
+		}
+	}
+	fclose(f);
+	return true;
+}
+
+static void writeTrace(Trace const *t, char const *name) {
+	FILE *f = fopen(name, "w");
+	if (!f) {
+		fprintf(stderr, "%s: %s\n", name, strerror(errno));
+		return;
+	}
+	fprintf(f, "# us encoder signals, then m start_us end_us encoder dir\n");
+	for (size_t i = 0; i < t->numEdges; i++) {
+		fprintf(f, "%lu %u %u\n", (unsigned long) t->edges[i].us, t->edges[i].num,
+			t->edges[i].signals);
+	}
+	for (size_t i = 0; i < t->numExpected; i++) {
+		Expected const *e = t->expected + i;
+		fprintf(f, "m %lu %lu %u %u\n", (unsigned long) e->start,
+			(unsigned long) e->end, e->num, e->dir);
+	}
+	fclose(f);
+}
+
+//
+// Generating traces
+//
+
+typedef struct {
+	int detents;
+	int bounces;
+	int reversePercent;
+	int abortPercent;
+	bool swapTypes;
+} GenOptions;
+
+// Signals at each quadrature position. Clockwise moves forward.
+static EncoderSignals const gray[4] = {0, 1, 3, 2};
+
+// Move one quadrature position, with up to maxBounces bounces of the
+// changing contact. Returns the time of the first edge.
+static uint32_t generateStep(Trace *t, int num, int from, int to, uint32_t *now,
+		uint32_t stepUs, int maxBounces) {
+	uint32_t first = *now;
+	int bounces = maxBounces ? rand() % (maxBounces + 1) : 0;
+	uint32_t gap = max(stepUs / (4 * (maxBounces + 1)), 2);
+	for (int b = 0; b < bounces; b++) {
+		addEdge(t, *now, num, gray[to]);
+		*now += 1 + rand() % gap;
+		addEdge(t, *now, num, gray[from]);
+		*now += 1 + rand() % gap;
+	}
+	addEdge(t, *now, num, gray[to]);
+	*now = first + stepUs;
+	return first;
+}
+
+// Generate detents for one encoder, starting at *now. Type A encoders
+// move every two quadrature positions, type B every four.
+static void generate(Trace *t, int num, bool typeB, uint32_t *now, GenOptions const *o) {
+	// The state machines start lost: show them both signal levels first
+	addEdge(t, *now, num, 3);
+	addEdge(t, *now + 1000, num, 0);
+	*now += 10000;
+
+	int steps = typeB ? 4 : 2;
+	int pos = 0;
+
+	// Turn slowly, resting at each detent, until the type is detected.
+	// These moves are not expected: the state table may be wrong.
+	for (int d = 0; d < ENCODER_DETECT_RESTS; d++) {
+		for (int s = 0; s < steps; s++, pos = (pos + 1) & 3) {
+			generateStep(t, num, pos, (pos + 1) & 3, now, 2000, o->bounces);
+		}
+		*now += ENCODER_REST_MS * 1000 + rand() % 100000;
+	}
+
+	EncoderDirection dir = ENC_CW;
+	// Index of the move waiting for its window to close
+	long open = -1;
+	for (int d = 0; d < o->detents; d++) {
+		if (rand() % 100 < o->reversePercent) {
+			dir = dir == ENC_CW ? ENC_CCW : ENC_CW;
+		}
+		int delta = dir == ENC_CW ? 1 : 3;
+
+		// 2 to 100ms per detent
+		uint32_t stepUs = (2000 + rand() % 98000) / steps;
+		if (rand() % 100 < o->abortPercent) {
+			// Half way there and back: no move
+			for (int s = 0; s < steps / 2; s++, pos = (pos + delta) & 3) {
+				uint32_t first = generateStep(t, num, pos, (pos + delta) & 3, now, stepUs, o->bounces);
+				if (open >= 0) {
+					t->expected[open].end = first;
+					open = -1;
+				}
+			}
+			for (int s = 0; s < steps / 2; s++, pos = (pos - delta) & 3) {
+				generateStep(t, num, pos, (pos - delta) & 3, now, stepUs, o->bounces);
+			}
+			continue;
+		}
+		for (int s = 0; s < steps; s++, pos = (pos + delta) & 3) {
+			uint32_t first = generateStep(t, num, pos, (pos + delta) & 3, now, stepUs, o->bounces);
+			if (open >= 0) {
+				t->expected[open].end = first;
+				open = -1;
+			}
+			if (s == steps - 1) {
+				addExpected(t, first, UINT32_MAX, num, dir);
+				open = t->numExpected - 1;
+			}
+		}
+	}
+	*now += 100000;
+}
+
+//
+// Replay and scoring
+//
+
+// Run every edge through the PIOC handler. Returns the seconds taken.
+static double replay(Trace const *t) {
+	uint32_t pins = 0;
+	struct timespec start, end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (size_t i = 0; i < t->numEdges; i++) {
+		Edge const *e = t->edges + i;
+		int shift = 12 + 2 * e->num;
+		pins = (pins & ~(3 << shift)) | (uint32_t) e->signals << shift;
+		PIOC->PIO_PDSR = pins;
+		edgeUs = e->us;
+		DWT->CYCCNT = e->us * CYCLES_PER_US;
+		encoderPIOCHandler(0, ENCODER_PINS);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	return (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+// Write the pin snapshots captured as the et command does
+static void writeCapture(char const *name) {
+	FILE *f = fopen(name, "wb");
+	if (!f) {
+		fprintf(stderr, "%s: %s\n", name, strerror(errno));
+		return;
+	}
+	uint32_t start;
+	uint32_t count = encoderCaptureStop(&start);
+	uint32_t first = count > ENCODER_CAPTURE ? count - ENCODER_CAPTURE : 0;
+	fprintf(f, "edges %lu %lu %lu\r\n", (unsigned long) count,
+		(unsigned long) (count - first), (unsigned long) start);
+	for (uint32_t i = first; i < count; i++) {
+		fwrite(encoderCaptured(i), sizeof(EncoderEdge), 1, f);
+	}
+	fclose(f);
+}
+
+static char const *dirName(EncoderDirection dir) {
+	return dir == ENC_CW ? "CW" : dir == ENC_CCW ? "CCW" : "-";
+}
+
+// Match the moves detected for encoder num with those expected, in order.
+// Returns the number of false and missed moves.
+static int score(Trace const *t, int num) {
+	size_t expected = 0, detected = 0, falseMoves = 0, missed = 0;
+	size_t j = 0;
+	Expected const *e = t->expected;
+	uint32_t first = UINT32_MAX;
+	for (size_t k = 0; k < t->numExpected; k++) {
+		if (e[k].num == num) {
+			first = min(first, e[k].start);
+		}
+	}
+	for (size_t i = 0; i < numMoves; i++) {
+		EncoderMove const *m = &moves[i].move;
+		uint32_t us = moves[i].us;
+		if (m->num != num || us < first) {
+			continue;
+		}
+		detected++;
+
+		// Skip expected moves that have closed without being detected
+		for (; j < t->numExpected; j++) {
+			if (e[j].num != num) {
+				continue;
+			}
+			if (us < e[j].end) {
+				break;
+			}
+			missed++;
+		}
+		if (j < t->numExpected && us >= e[j].start && m->dir == e[j].dir) {
+			j++;
+		} else {
+			falseMoves++;
+			if (falseMoves <= 5) {
+				printf("  false %s at %luus\n", dirName(m->dir), (unsigned long) us);
+			}
+		}
+	}
+	for (; j < t->numExpected; j++) {
+		missed += e[j].num == num;
+	}
+	for (size_t k = 0; k < t->numExpected; k++) {
+		expected += e[k].num == num;
+	}
+	if (expected || detected) {
+		printf("Encoder %d: %zu expected, %zu detected, %zu false, %zu missed\n",
+			num, expected, detected, falseMoves, missed);
+	}
+	return falseMoves + missed;
+}
+
+static void usage(void) {
+	fprintf(stderr,
+		"Use: encoder_harness [-s seed] [-n detents] [-b bounces] [-r reverse%%] [-a abort%%] [-x] [-w file] [-c file]\n"
+		"     encoder_harness [-c file] file ...\n");
+	exit(2);
+}
+
+int main(int argc, char **argv) {
+	GenOptions o = {
+		.detents = 10000,
+		.bounces = 4,
+		.reversePercent = 10,
+		.abortPercent = 5,
+	};
+	unsigned seed = 1;
+	char const *writeName = NULL;
+	char const *captureName = NULL;
+	int c;
+	while ((c = getopt(argc, argv, "s:n:b:r:a:xw:c:")) != -1) {
+		switch (c) {
+		case 's': seed = strtoul(optarg, NULL, 0); break;
+		case 'n': o.detents = atoi(optarg); break;
+		case 'b': o.bounces = atoi(optarg); break;
+		case 'r': o.reversePercent = atoi(optarg); break;
+		case 'a': o.abortPercent = atoi(optarg); break;
+		case 'x': o.swapTypes = true; break;
+		case 'w': writeName = optarg; break;
+		case 'c': captureName = optarg; break;
+		default: usage();
+		}
+	}
+
+	Trace t = {0};
+	// Detent types generated, if known
+	char types[NUM_ENCODERS] = {0};
+	if (optind < argc) {
+		for (int i = optind; i < argc; i++) {
+			if (!readTrace(&t, argv[i])) {
+				return 2;
+			}
+		}
+	} else {
+		srand(seed);
+		uint32_t now = 0;
+		generate(&t, 0, o.swapTypes, &now, &o);
+		generate(&t, 2, !o.swapTypes, &now, &o);
+		types[0] = o.swapTypes ? 'B' : 'A';
+		types[2] = o.swapTypes ? 'A' : 'B';
+		if (writeName) {
+			writeTrace(&t, writeName);
+		}
+	}
+
+	startEncoders();
+	encoderDebugListen(true);
+	if (captureName) {
+		encoderCaptureStart();
+	}
+	double seconds = replay(&t);
+	if (captureName) {
+		writeCapture(captureName);
+	}
+
+	int errors = 0;
+	for (int num = 0; num < NUM_ENCODERS; num++) {
+		if (encoderStates[num].detecting) {
+			printf("Encoder %d: type not detected\n", num);
+			errors += types[num] != 0;
+		} else {
+			printf("Encoder %d: type %c detected\n", num, encoderType(num));
+			errors += types[num] && types[num] != encoderType(num);
+		}
+	}
+	if (t.numExpected) {
+		for (int num = 0; num < NUM_ENCODERS; num++) {
+			errors += score(&t, num);
+		}
+	} else {
+		for (size_t i = 0; i < numMoves; i++) {
+			printf("%lu %d %s\n", (unsigned long) moves[i].us,
+				moves[i].move.num, dirName(moves[i].move.dir));
+		}
+	}
+	printf("%zu edges, %zu moves, %lu UI wake-ups\n", t.numEdges, numMoves,
+		(unsigned long) wakeUps);
+	if (seconds > 0) {
+		printf("%.1f million edges per second\n", t.numEdges / seconds / 1e6);
+	}
+	return errors ? 1 : 0;
+}
@@ -3,15 +3,254 @@
 
 #include "decls.h"
 
-// The current mode
-static volatile AudioMode mode;
+// Parameter blocks: one published, one in use by the audio interrupt if it
+// has not yet adopted the published one, and one being edited. Writers hold
+// a critical section, which does not mask the audio interrupt, so they never
+// edit a block the interrupt may read.
+static AudioParams paramBlocks[3] = {
+	{
+		.noiseShaping = true,
+		.dither = true,
+		.gateEnabled = true,
+		.gateThreshold = 103, // -50dB
+		.gateThresholdDb = 50,
+		.gateHoldSamples = AUDIO_SAMPLE_RATE, // 1s
+		.envelopeFloor = US_PERIOD / 8,
+	},
+};
+static AudioParams *volatile publishedParams = paramBlocks;
+static AudioParams *editParams;
 
-// The volume (used to scale output in AM_HZ mode)
-volatile uint8_t audioVolume;
+// Params in use by the audio interrupt, and the tone frequency it has
+// applied to the synth. Owner: audio interrupt.
+static AudioParams const *params = paramBlocks;
+static uint32_t toneFreq;
 
-// The current frequency (or zero for off). Used in AM_HZ mode.
-static uint32_t currFreq;
+// params, for tasks choosing a block to edit
+static AudioParams const *volatile adoptedParams = paramBlocks;
 
+// Last two quantization errors of the PWM duty, in 1/32768ths of a count.
+// Owner: audio interrupt.
+static int32_t dutyError1;
+static int32_t dutyError2;
+
+// Dither random number state. Owner: audio interrupt.
+static uint32_t ditherRandom = 1;
+
+// Triangular dither between -1 and +1 LSB, in 1/32768ths of an LSB
+static inline int32_t audioDitherValue(void) {
+	uint32_t x = ditherRandom;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	ditherRandom = x;
+	return (int32_t) (x & 0x7fff) - (int32_t) (x >> 17);
+}
+
+// Quantize duty delta, with 15 bits of fraction, to whole PWM counts
+// between -limit and limit.
+// When noise shaping, the error is fed back so that its spectrum is shaped
+// by (1 - z^-1)^2, moving quantization noise from the audible band
+// up towards 20kHz.
+static inline int32_t audioQuantizeDuty(int32_t duty, int32_t limit) {
+	if (!params->noiseShaping) {
+		return (duty + (1 << 14)) >> 15;
+	}
+	int32_t shaped = duty + 2 * dutyError1 - dutyError2;
+	int32_t q = min(max((shaped + (1 << 14)) >> 15, -limit), limit);
+	
+	// Limit error so that clipping cannot make the loop unstable
+	int32_t error = min(max(shaped - (q << 15), -(1 << 15)), 1 << 15);
+	dutyError2 = dutyError1;
+	dutyError1 = error;
+	return q;
+}
+
+//
+// Stages for the audio chain. All execute from within the audio interrupt.
+//
+
+// Sum of ADC channels 0 and 1
+static int32_t adcProcess(int32_t sample) {
+	// TODO: replace with DMA.
+	uint32_t data0 = adc_get_channel_value(ADC, 0);
+	uint32_t data1 = adc_get_channel_value(ADC, 1);
+	uint32_t sum = data0 + data1; // sum is a 13 bit value
+	return ((int32_t) sum - 4096) * 8;
+}
+
+static int32_t synthProcess(int32_t sample) {
+	return synthNextSample();
+}
+
+static int32_t clipProcess(int32_t sample) {
+	return clipNextSample();
+}
+
+static int32_t siggenProcess(int32_t sample) {
+	return siggenNextSample();
+}
+
+// Previous input and output of DC blocking filter, output with 14 bits of
+// fraction
+static int32_t dcBlockIn;
+static int32_t dcBlockOut;
+
+// One pole high pass at about 25Hz, removing input bias
+static int32_t dcBlockProcess(int32_t sample) {
+	dcBlockOut += (sample - dcBlockIn) * 16384 - (dcBlockOut >> 8);
+	dcBlockIn = sample;
+	return __SSAT(dcBlockOut >> 14, 16);
+}
+
+static int32_t volumeProcess(int32_t sample) {
+	return sample * params->volume / 255;
+}
+
+// Silence gate gain, 15 bits of fraction, ramped at these rates
+#define GATE_UNITY (1 << 15)
+#define GATE_ATTACK_STEP (GATE_UNITY / (AUDIO_SAMPLE_RATE / 1000)) // 1ms
+#define GATE_RELEASE_STEP (GATE_UNITY / (AUDIO_SAMPLE_RATE / 50)) // 20ms
+
+// Silence gate state. Owner: audio interrupt.
+static int32_t gateGain = GATE_UNITY;
+static uint32_t gateQuietSamples;
+static volatile bool gateOpen = true;
+
+// Fade out and shut down the H-bridge once the signal has been below the
+// threshold for the hold time. Turn it straight back on, with a fast fade
+// in, when the signal returns.
+static int32_t gateProcess(int32_t sample) {
+	if (!params->gateEnabled || abs(sample) >= params->gateThreshold) {
+		gateQuietSamples = 0;
+		if (!gateOpen) {
+			gateOpen = true;
+			ioport_set_pin_level(PIO_PC4_IDX, true);
+		}
+	} else if (gateOpen && ++gateQuietSamples >= params->gateHoldSamples) {
+		gateOpen = false;
+	}
+	
+	if (gateOpen) {
+		gateGain = min(gateGain + GATE_ATTACK_STEP, GATE_UNITY);
+	} else {
+		gateGain = max(gateGain - GATE_RELEASE_STEP, 0);
+		if (gateGain == 0) {
+			// Held low, since a mode change may have turned the bridge on
+			ioport_set_pin_level(PIO_PC4_IDX, false);
+		}
+	}
+	return (sample * gateGain) >> 15;
+}
+
+// Write the sample to DACC, passing it on unchanged
+static int32_t daccProcess(int32_t sample) {
+	// 15 bits of fraction until rounded
+	int32_t dac = sample * 2046;
+	if (params->dither) {
+		dac += audioDitherValue();
+	}
+	dacc_write_conversion_data(DACC, 2048 + ((dac + (1 << 14)) >> 15));
+	return sample;
+}
+
+// Envelope of recent samples, with 16 bits of fraction.
+// Owner: audio interrupt.
+static uint32_t envelope;
+
+// Sum of duty midpoints, for the average drive level. Owner: audio interrupt.
+static uint64_t driveSum;
+static uint32_t driveSamples;
+
+// Set by task to ask for the drive level. Cleared by audio interrupt once it
+// has copied the sums here and started again.
+static volatile bool driveRequest;
+static uint64_t driveReportSum;
+static uint32_t driveReportSamples;
+
+// Convert sample to a PWM duty around a midpoint. The midpoint sets the
+// carrier level: it is half the period, for full drive, unless envelope
+// tracking moves it down towards the floor in quiet passages.
+static int32_t dutyProcess(int32_t sample) {
+	int32_t mid = US_PERIOD / 2;
+	if (params->envelopeTracking) {
+		// Instant attack, so the signal always fits. Release time constant
+		// is 2^13 samples, about 200ms.
+		uint32_t level = ((uint32_t) abs(sample)) << 16;
+		envelope = max(level, envelope - (envelope >> 13));
+		int32_t floor = params->envelopeFloor;
+		mid = floor + (((US_PERIOD / 2 - floor) * (int32_t) (envelope >> 16)) >> 15);
+	}
+	// No drive once the silence gate has shut down the bridge
+	if (gateGain) {
+		driveSum += mid;
+	}
+	driveSamples++;
+	
+	int32_t limit = mid - 1;
+	return mid + audioQuantizeDuty(sample * limit, limit);
+}
+
+// Set the PWM duty. Must be between 0 and US_PERIOD, non inclusive.
+static int32_t pwmProcess(int32_t duty) {
+	PWM->PWM_CH_NUM[2].PWM_CDTYUPD = duty;
+	return duty;
+}
+
+static AudioStage const adcStage = {"adc", STAGE_SOURCE, adcProcess, 40};
+static AudioStage const synthStage = {"synth", STAGE_SOURCE, synthProcess, 400};
+static AudioStage const clipStage = {"clip", STAGE_SOURCE, clipProcess, 200};
+static AudioStage const siggenStage = {"siggen", STAGE_SOURCE, siggenProcess, 300};
+static AudioStage const dcBlockStage = {"dcblock", STAGE_FILTER, dcBlockProcess, 20};
+static AudioStage const volumeStage = {"volume", STAGE_GAIN, volumeProcess, 30};
+static AudioStage const gateStage = {"gate", STAGE_GAIN, gateProcess, 40};
+static AudioStage const dutyStage = {"duty", STAGE_MODULATOR, dutyProcess, 40};
+static AudioStage const daccStage = {"dacc", STAGE_SINK, daccProcess, 40};
+static AudioStage const pwmStage = {"pwm", STAGE_SINK, pwmProcess, 15};
+
+// Chain of stages for each mode
+static AudioStage const *const adcChain[] = {
+	&adcStage, &dcBlockStage, &gateStage, &daccStage, &dutyStage, &pwmStage, NULL
+};
+static AudioStage const *const synthChain[] = {
+	&synthStage, &volumeStage, &gateStage, &daccStage, &dutyStage, &pwmStage, NULL
+};
+static AudioStage const *const clipChain[] = {
+	&clipStage, &volumeStage, &gateStage, &daccStage, &dutyStage, &pwmStage, NULL
+};
+static AudioStage const *const siggenChain[] = {
+	&siggenStage, &volumeStage, &gateStage, &daccStage, &dutyStage, &pwmStage, NULL
+};
+static AudioStage const *const *const modeChains[] = {
+	[AM_OFF] = NULL,
+	[AM_ADC] = adcChain,
+	[AM_HZ] = synthChain,
+	[AM_CLIP] = clipChain,
+	[AM_SIGGEN] = siggenChain,
+};
+
+// Adopt newly published params.
+// Executes from within an interrupt
+static void audioAdopt(AudioParams const *p) {
+	// A mode change turns all voices off
+	if (p->mode != params->mode) {
+		toneFreq = 0;
+	}
+	
+	// Start, glide or stop the tone
+	if (p->freq != toneFreq) {
+		if (p->freq == 0) {
+			synthNoteOff(TONE_VOICE);
+		} else if (toneFreq == 0) {
+			synthNoteOn(TONE_VOICE, synthIncrement(p->freq));
+		} else {
+			synthPitchSet(TONE_VOICE, synthIncrement(p->freq));
+		}
+		toneFreq = p->freq;
+	}
+	params = p;
+	adoptedParams = p;
+}
 
 // 40kHz sampler.
 //
@@ -25,44 +264,22 @@ void PWM_Handler(void) {
 		fatalBlink(1, 6);
 	}
 	
-	if (mode == AM_ADC) {
-		// Temporary code - read ADC, calculate result.
-		// TODO: replace with DMA.
-		// TODO: handle fading.
-		uint32_t data0 = adc_get_channel_value(ADC, 0);
-		uint32_t data1 = adc_get_channel_value(ADC, 1);
-		uint32_t sum = data0 + data1; // sum is a 13 bit value
-	
-		// Calculate output value for DACC
-		dacc_write_conversion_data(DACC, sum / 2);
-	
-		// Calculate duty cycle value for PWM Channel 2.
-		// Calculated value must be between 0 and US_PERIOD-1, non inclusive.
+	if (driveRequest) {
+		driveReportSum = driveSum;
+		driveReportSamples = driveSamples;
+		driveSum = 0;
+		driveSamples = 0;
+		driveRequest = false;
+	}
 	
-		int32_t duty = ((US_PERIOD - 2) * sum / 8192) + 1;
-		// For testing with silence
-		// int32_t duty = US_PERIOD / 2;
-		PWM->PWM_CH_NUM[2].PWM_CDTYUPD = duty;	
-	} else if (mode == AM_HZ) {
-		
-		
-		// Get TIOA value from status register
-		bool mtioa = TC0->TC_CHANNEL[0].TC_SR & TC_SR_MTIOA;
-		
-		// Write to DACC
-		int16_t dDelta = 2046 * audioVolume / 255;
-		if (!mtioa) {
-			dDelta = -dDelta;
-		}
-		dacc_write_conversion_data(DACC, dDelta + 2048);
-		
-		// Set PWM
-		int16_t pDelta = (US_PERIOD - 2) / 2 * audioVolume / 255;
-		if (!mtioa) {
-			pDelta = -pDelta;
-		}
-		PWM->PWM_CH_NUM[2].PWM_CDTYUPD = pDelta + (US_PERIOD / 2);
+	// Pick up parameter changes at the period boundary
+	AudioParams const *p = publishedParams;
+	if (p->sequence != params->sequence) {
+		audioAdopt(p);
 	}
+	
+	chainRun(&params->chain);
+	captureSample();
 }
 
 // Turn on the PWM output
@@ -78,62 +295,169 @@ static void pwmOff(void) {
 	ioport_set_pin_level(PIO_PC4_IDX, false);
 }
 
-// Set the frequency of the generated tone. 0 means off.
-void audioFrequencySet(uint32_t freq) {
-	// In order to avoid audio hiccups, don't do anything if setting 
-	// same frequency again. 
-	if (currFreq == freq) {
-		return;
+// Start editing audio params. Returns a copy of the published params to
+// change, then publish with audioParamsPublish. Must not block in between.
+AudioParams *audioParamsEdit(void) {
+	taskENTER_CRITICAL();
+	// The interrupt only ever moves on to the published block, so the block
+	// that is neither published nor in use stays free while it is edited
+	AudioParams const *adopted = adoptedParams;
+	AudioParams *p = paramBlocks;
+	while (p == publishedParams || p == adopted) {
+		p++;
 	}
-	
-	tc_stop(TC0, 0);
-	if (freq == 0) {
-		return;
-	}
-	
-	// Find the best divisor for this frequency
-	uint32_t ul_div, ul_tcclks;
-	tc_find_mck_divisor(freq, SystemCoreClock, 
-		&ul_div, &ul_tcclks, SystemCoreClock);
-		
-	// Put Timer into wavesel up RC mode with TIOA at 50% duty cycle
-	// Clear TIOA at CPC match and set at CPA match
-	tc_init(TC0, 0, ul_tcclks | TC_CMR_WAVE | TC_CMR_WAVSEL_UP_RC | TC_CMR_ACPC_CLEAR | TC_CMR_ACPA_SET);
-	uint16_t rcVal = (SystemCoreClock / ul_div) / freq;
-	tc_write_rc(TC0, 0, rcVal);
-	tc_write_ra(TC0, 0, rcVal / 2);  // 50% duty cycle
-	
-	// Start the thing
-	tc_start(TC0, 0);
-	
-	currFreq = freq;
+	*p = *publishedParams;
+	editParams = p;
+	return p;
 }
-	
 
-// Set the audio mode
-void audioModeSet(AudioMode m) {
-	// Don't do anything if mode is not changed
-	if (mode == m) {
-		return;
-	}
+// Publish the params being edited. The audio interrupt adopts them at the
+// start of its next period.
+void audioParamsPublish(void) {
+	editParams->sequence++;
+	publishedParams = editParams;
+	taskEXIT_CRITICAL();
+}
+
+// The most recently published params
+AudioParams const *audioParams(void) {
+	return publishedParams;
+}
+
+// Whether the audio interrupt runs, or is about to run, mode m's chain: the
+// published mode, or the one still in use until the interrupt adopts it
+bool audioModeActive(AudioMode m) {
+	return publishedParams->mode == m || adoptedParams->mode == m;
+}
+
+// Change the mode in params being edited. Stops everything that might be
+// making sound in the old mode.
+static void audioEditMode(AudioParams *p, AudioMode m) {
+	playerStop();
+	synthAllOff();
+	clipStop();
+	siggenStop();
+	p->mode = m;
+	p->freq = 0; // Always reset freq on mode change
 	
-	// Set new mode
-	mode = m;
-	audioFrequencySet(0); // Always reset currFreq on mode change
+	// Chains are fixed, so failing the budget is a bug
+	ASSERT_BLINK(chainBuild(&p->chain, modeChains[m]), 2, 6);
+}
+
+// Set up the output hardware for a new mode
+static void audioHardwareSet(AudioMode m) {
 	switch (m) {
 		case AM_OFF:
 			pwmOff();
 			dacc_disable_channel(DACC, 0);
 			break;
 		case AM_ADC:
-			pwmOn();
-			pwm_channel_enable(PWM, PWM_CHANNEL_2);
-			dacc_enable_channel(DACC, 0);
-			break;
 		case AM_HZ:
+		case AM_CLIP:
+		case AM_SIGGEN:
 			pwmOn();
-			pwm_channel_enable(PWM, PWM_CHANNEL_2);
 			dacc_enable_channel(DACC, 0);
 			break;
 	}
 }
+
+// Set the audio mode. Does nothing if already in mode m.
+void audioModeSet(AudioMode m) {
+	AudioParams *p = audioParamsEdit();
+	bool changed = p->mode != m;
+	if (changed) {
+		audioEditMode(p, m);
+	}
+	audioParamsPublish();
+	if (changed) {
+		audioHardwareSet(m);
+	}
+}
+
+// Set the frequency of the generated tone, in Hz with 16 bits of fraction.
+// 0 means off. In order to avoid audio hiccups, setting the same frequency again does
+// not restart the tone.
+void audioFrequencySet(uint32_t hz) {
+	AudioParams *p = audioParamsEdit();
+	p->freq = hz;
+	audioParamsPublish();
+}
+
+// Set the volume, 0 to 255
+void audioVolumeSet(uint8_t volume) {
+	AudioParams *p = audioParamsEdit();
+	p->volume = volume;
+	audioParamsPublish();
+}
+
+// Set mode, tone frequency and volume together. The frequency is reset to
+// hz even if the mode changes.
+void audioSet(AudioMode m, uint32_t hz, uint8_t volume) {
+	AudioParams *p = audioParamsEdit();
+	bool changed = p->mode != m;
+	if (changed) {
+		audioEditMode(p, m);
+	}
+	p->freq = hz;
+	p->volume = volume;
+	audioParamsPublish();
+	if (changed) {
+		audioHardwareSet(m);
+	}
+}
+
+// Set PWM duty noise shaping and DACC dither
+void audioQuantizationSet(bool noiseShaping, bool dither) {
+	AudioParams *p = audioParamsEdit();
+	p->noiseShaping = noiseShaping;
+	p->dither = dither;
+	audioParamsPublish();
+}
+
+// Set up the silence gate. It closes after the signal has been more than
+// thresholdDb below full scale for holdMs.
+void audioGateSet(bool enabled, uint8_t thresholdDb, uint16_t holdMs) {
+	int32_t threshold = 32768 * powf(10, thresholdDb / -20.0f);
+	AudioParams *p = audioParamsEdit();
+	p->gateEnabled = enabled;
+	p->gateThreshold = threshold;
+	p->gateThresholdDb = thresholdDb;
+	p->gateHoldSamples = holdMs * (AUDIO_SAMPLE_RATE / 1000);
+	audioParamsPublish();
+}
+
+// Whether the silence gate is letting sound through
+bool audioGateIsOpen(void) {
+	return gateOpen;
+}
+
+// Set up envelope tracking of the carrier level. When enabled, the level
+// falls as low as floorPercent of full drive in quiet passages.
+void audioEnvelopeTrackingSet(bool enabled, uint8_t floorPercent) {
+	int32_t floor = max((US_PERIOD / 2) * floorPercent / 100, 2);
+	AudioParams *p = audioParamsEdit();
+	p->envelopeTracking = enabled;
+	p->envelopeFloor = floor;
+	audioParamsPublish();
+}
+
+// Average carrier drive level since the last call, in tenths of a percent
+// of full drive, and the number of samples it was averaged over. Blocks for
+// a few ms.
+uint32_t audioDriveTake(uint32_t *samples) {
+	driveRequest = true;
+	for (int i = 0; i < 5 && driveRequest; i++) {
+		vTaskDelay(1);
+	}
+	if (driveRequest) {
+		// Interrupt not running - carrier is off
+		driveRequest = false;
+		*samples = 0;
+		return 0;
+	}
+	*samples = driveReportSamples;
+	if (!driveReportSamples) {
+		return 0;
+	}
+	return driveReportSum * 1000 / ((uint64_t) driveReportSamples * (US_PERIOD / 2));
+}
@@ -0,0 +1,66 @@
+// capture.c
+//
+// Captures ADC samples into RAM from the audio interrupt.
+//
+// A capture accumulates a number of consecutive periods of a fixed length
+// into a buffer, so that repeated periodic signals are averaged for free.
+// The task that asks for a capture owns the buffer and polls for completion.
+
+#include "decls.h"
+
+// Capture request. Written by task while no capture is active.
+static int32_t *buffer;
+static uint32_t length;
+static uint32_t channel;
+
+// Samples still to capture. Set by task to start, counted down by interrupt.
+static volatile uint32_t remaining;
+
+// Index into buffer of next sample. Owner: audio interrupt.
+static uint32_t writeIndex;
+static bool started;
+
+// Signal generator position at the first captured sample
+static volatile uint32_t startPosition;
+
+// Start a capture. Returns false if one is already running.
+bool captureStart(int32_t *buf, uint32_t len, uint32_t periods, uint32_t chan) {
+	if (remaining) {
+		return false;
+	}
+	memset(buf, 0, len * sizeof(int32_t));
+	buffer = buf;
+	length = len;
+	channel = chan;
+	writeIndex = 0;
+	started = false;
+	remaining = len * periods; // Starts capture
+	return true;
+}
+
+// Whether the last capture has finished
+bool captureIsDone(void) {
+	return remaining == 0;
+}
+
+// Signal generator position when the last capture started
+uint32_t captureStartPosition(void) {
+	return startPosition;
+}
+
+// Capture a sample, if capturing.
+// Executes from within an interrupt
+void captureSample(void) {
+	if (!remaining) {
+		return;
+	}
+	if (!started) {
+		startPosition = siggenPosition();
+		started = true;
+	}
+	buffer[writeIndex] += adc_get_channel_value(ADC, channel);
+	if (++writeIndex == length) {
+		writeIndex = 0;
+	}
+	remaining--;
+}
@@ -0,0 +1,75 @@
+// chain.c
+//
+// The audio processing chain run by the audio interrupt.
+//
+// Each audio mode is a list of stages: a source, then any filters and
+// gains, then the modulator and sinks that drive the hardware. A chain is
+// built and checked against the cycle budget when the mode changes, so the
+// interrupt just calls each stage in turn. The interrupt times every stage
+// with the DWT cycle counter, so estimates can be checked against reality.
+
+#include "decls.h"
+
+// Number of chains built. Identifies each chain.
+static uint32_t builds;
+
+// Measured cost of each stage of the running chain. Owner: audio interrupt.
+static uint32_t runningId;
+static StageCycles stageCycles[CHAIN_MAX_STAGES];
+static uint32_t chainSamples;
+
+// Build a chain from a NULL terminated list of stages. A NULL list builds
+// an empty chain, which does nothing. Returns false if the stages are not
+// a valid chain or their estimated cost is over CHAIN_CYCLE_BUDGET.
+bool chainBuild(AudioChain *c, AudioStage const *const *stages) {
+	c->id = ++builds;
+	c->numStages = 0;
+	c->cycles = 0;
+	if (!stages) {
+		return true;
+	}
+
+	for (; *stages; stages++) {
+		if (c->numStages == CHAIN_MAX_STAGES) {
+			return false;
+		}
+		c->stages[c->numStages++] = *stages;
+		c->cycles += (*stages)->cycles;
+	}
+
+	// Must take a sample from somewhere and put it somewhere
+	return c->numStages >= 2 &&
+		c->stages[0]->kind == STAGE_SOURCE &&
+		c->stages[c->numStages - 1]->kind == STAGE_SINK &&
+		c->cycles <= CHAIN_CYCLE_BUDGET;
+}
+
+// Run a chain for one sample.
+// Executes from within an interrupt
+void chainRun(AudioChain const *c) {
+	if (c->id != runningId) {
+		// New chain - start measuring again
+		runningId = c->id;
+		memset(stageCycles, 0, sizeof(stageCycles));
+		chainSamples = 0;
+	}
+
+	int32_t sample = 0;
+	uint32_t start = DWT->CYCCNT;
+	for (int i = 0; i < c->numStages; i++) {
+		sample = c->stages[i]->process(sample);
+		uint32_t now = DWT->CYCCNT;
+		uint32_t cycles = now - start;
+		stageCycles[i].total += cycles;
+		stageCycles[i].max = max(stageCycles[i].max, cycles);
+		start = now;
+	}
+	chainSamples++;
+}
+
+// Measured cycles for each stage of the running chain, and the number of
+// samples they were measured over. For debugging: values may be torn.
+StageCycles const *chainCycles(uint32_t *samples) {
+	*samples = chainSamples;
+	return stageCycles;
+}
@@ -13,6 +13,7 @@ static char const *MSG_CHANNEL_NOT_VALID = "Channel param must be between 0 and
 static char const *MSG_SAMPLES_NOT_VALID = "Samples param must be between 1 and 10000.\r\n";
 static char const *MSG_SECONDS_NOT_VALID = "Seconds param must be between 0 and 30.\r\n";
 static char const *MSG_ENCODER_NOT_VALID = "Encoder param must be between 0 and 3.\r\n";
+static char const *MSG_ACCEL_USAGE = "Use: ea [threshold gain max], with threshold 0-1000, gain 0-255 and max 1-255\r\n";
 static char const *MSG_SPI_BUSY = "SPI mutex is busy. Please Try again.\r\n";
 static char const *MSG_SPI_MUTEX_ERROR = "Could not release SPI mutex.\r\n";
 static char const *MSG_POT_ADDR_NOT_VALID = "Addr param must be between 0 and 0xf.\r\n";
@@ -27,8 +28,38 @@ static char const *MSG_RESPONSE = "Response: ";
 static char const *MSG_SCREEN_REG_INVALID = "Register must be in range 00..ff\r\n";
 static char const *MSG_SCREEN_DATA_INVALID = "Data must be in range 00..ff\r\n";
 static char const *MSG_SCREEN_CMD_INVALID = "Screen command number not valid\r\n";
-static char const *MSG_INVALID_MODE = "Audio mode must be 0, 1 or 2\r\n";
+static char const *MSG_INVALID_MODE = "Audio mode must be 0 (off), 1 (ADC) or 2 (Hz). Use cp for clips and sg for signals.\r\n";
+static char const *MSG_INVALID_HZ = "Frequency must be between 0 and 19999Hz\r\n";
+static char const *MSG_INVALID_TEMPERAMENT = "Temperament not valid. Use nt alone to list them.\r\n";
+static char const *MSG_INVALID_DETUNE = "Note must be 0 (C) to 11 (B). Cents must be -100 to 100.\r\n";
+static char const *MSG_INVALID_TEMPO = "Tempo must be 25 to 400%. Transpose must be -24 to 24.\r\n";
 static char const *MSG_INVALID_VOLUME = "Volume must be between 0 and 255\r\r";
+static char const *MSG_GATE_USAGE = "Use: gt enable threshold_db hold_ms, with threshold 0-90 and hold 1-60000\r\n";
+static char const *MSG_DRIVE_USAGE = "Use: dt [enable floor_percent], with floor 1-100\r\n";
+static char const *MSG_NO_CHAIN = "No audio chain running\r\n";
+static char const *MSG_INVALID_FLAG = "Flags must be 0 (off) or 1 (on)\r\n";
+static char const *MSG_INVALID_ENVELOPE_TIME = "Envelope times must be between 0 and 5000ms\r\n";
+static char const *MSG_INVALID_CLIP = "Clip number not valid. Use cl to list clips.\r\n";
+static char const *MSG_SIGGEN_USAGE = "Use one of:\r\n"
+	"  sg sweep f0 f1 ms (rising less than 4 times per 1.6ms)\r\n"
+	"  sg mls order seed\r\n"
+	"  sg pink seed\r\n"
+	"  sg tones seed f1 [f2 f3 f4]\r\n";
+static char const *MSG_MEASURE_USAGE = "Use: fr f0 f1 periods channel, with 0 < f0 < f1 < 20000, periods 1-64\r\n";
+static char const *MSG_MEASURE_FAILED = "Measurement failed - capture did not complete\r\n";
+static char const *MSG_INVALID_SUSTAIN = "Sustain must be between 0 and 255\r\n";
+static char const *MSG_INVALID_SLOT = "Slot must be 0 or 1\r\n";
+static char const *MSG_EMPTY_SLOT = "Slot is empty\r\n";
+static char const *MSG_UPLOAD_READY = "READY\r\n";
+static char const *MSG_UPLOAD_BAD_DATA = "Not valid, or could not be stored\r\n";
+static char const *MSG_LIBRARY_USAGE = "Use: lu t|c slot name length [rate], with slot 0-31 and rate for clips only\r\n";
+static char const *MSG_LIBRARY_FULL = "No room in library\r\n";
+static char const *UPLOAD_RESULTS[] = {
+	[UPLOAD_OK] = "OK",
+	[UPLOAD_TIMEOUT] = "timed out",
+	[UPLOAD_REFUSED] = "too big, or could not be written",
+	[UPLOAD_BAD_FRAMES] = "too many bad frames",
+};
 
 static char const POT_REG_NAMES[6][7] = {
 	"R0    ",
@@ -63,6 +94,13 @@ static void consoleWriteTxBuf(void) {
 	txBuf[0] = '\0';
 }
 
+// Write length bytes of binary data from txBuf
+static void consoleWriteTxBinary(size_t length) {
+	status_code_t rc = freertos_uart_write_packet(
+	    freeRTOSUART, txBuf, length, MS_TO_TICKS(IO_WAIT_MS));
+	ASSERT_BLINK(rc == STATUS_OK, 2, 8);
+}
+
 // Write str to CLI
 static void consoleWrite(char const *str) {
 	// TODO: deal with str > 100 chars
@@ -214,41 +252,61 @@ static portBASE_TYPE adcDumpCommand(
 	return pdFALSE;
 }
 
-// Command to track encoder behavior
+// Command to capture encoder edges
 static portBASE_TYPE encoderTrackCommand(
 	int8_t *pcWriteBuffer,
 	size_t xWriteBufferLen,
 	const int8_t *pcCommandString) {
 		
-	// encoder
+	// scan through command then whitespace to seconds param
 	int8_t const *p = findNextParam(pcCommandString);
-	
-	int enc = parseInt(p, 0);
-	if (enc < 0 || enc > 3) {
-		consoleWrite(MSG_ENCODER_NOT_VALID);
-		return pdFALSE;
-	}	
-	
-	// scan through encoder then whitespace to seconds param
-	p = findNextParam(p);
 	int seconds = parseInt(p, 0);
 	if (seconds < 0 || seconds > 30) {
 		consoleWrite(MSG_SECONDS_NOT_VALID);
 		return pdFALSE;
 	}
-	uint32_t endTicks = xTaskGetTickCount() + (seconds * 1000);
 	
-	EncoderState *encoder = encoderStates + enc;
-	uint32_t seen = 0;
-	while (xTaskGetTickCount() < endTicks) {
-		if (encoder->lastChange != seen) {
-			encoderStateSprint((char *) txBuf, txBufSize, encoder);
-			consoleWriteTxBuf();
-			consoleWrite(CRLF);
-			seen = encoder->lastChange;
+	// Capture, then dump in binary: a line with the snapshots taken and
+	// kept and the start cycle count, then the EncoderEdges kept, oldest
+	// first. scripts/edges.py decodes it.
+	encoderCaptureStart();
+	vTaskDelay(MS_TO_TICKS(seconds * 1000));
+	uint32_t start;
+	uint32_t count = encoderCaptureStop(&start);
+	uint32_t first = count > ENCODER_CAPTURE ? count - ENCODER_CAPTURE : 0;
+	snprintf((char *) txBuf, txBufSize, "edges %lu %lu %lu\r\n",
+		count, count - first, start);
+	consoleWriteTxBuf();
+	
+	size_t perWrite = txBufSize / sizeof(EncoderEdge);
+	for (uint32_t i = first; i < count; ) {
+		size_t n = 0;
+		for (; n < perWrite && i < count; n++, i++) {
+			memcpy(txBuf + n * sizeof(EncoderEdge), encoderCaptured(i), sizeof(EncoderEdge));
 		}
-		vTaskDelay(1);
+		consoleWriteTxBinary(n * sizeof(EncoderEdge));
+	}
+	txBuf[0] = '\0';
+	return pdFALSE;
+}
+
+// Command to show an encoder's state and recent changes
+static portBASE_TYPE encoderStateCommand(
+	int8_t *pcWriteBuffer,
+	size_t xWriteBufferLen,
+	const int8_t *pcCommandString) {
+		
+	// encoder
+	int8_t const *p = findNextParam(pcCommandString);
+	int enc = parseInt(p, 0);
+	if (enc < 0 || enc > 3) {
+		consoleWrite(MSG_ENCODER_NOT_VALID);
+		return pdFALSE;
 	}
+	
+	encoderStateSprint((char *) txBuf, txBufSize, encoderStates + enc);
+	consoleWriteTxBuf();
+	consoleWrite(CRLF);
 	return pdFALSE;
 }
 
@@ -268,6 +326,8 @@ const int8_t *pcCommandString) {
 	}
 	
 	EncoderMove move;
+	uint32_t last = 0;
+	encoderDebugListen(true);
 	for (int seconds = 0; seconds < limitSeconds; seconds++) {
 		snprintf((char *) txBuf, txBufSize, "%d:\r\n", seconds);
 		consoleWriteTxBuf();
@@ -275,16 +335,102 @@ const int8_t *pcCommandString) {
 		while (xTaskGetTickCount() < endTicks) {
 			uint32_t ticks = endTicks - xTaskGetTickCount();
 		    if (xQueueReceive(encoderDebugQueue, &move, ticks)) {
-				snprintf((char *) txBuf, txBufSize, "  %d - %s\r\n", 
-				    move.num, encoderLabel(move.dir));
+				// Time since the previous move, of any encoder
+				snprintf((char *) txBuf, txBufSize, "  %d - %s +%luus\r\n", 
+				    move.num, encoderLabel(move.dir), 
+					last ? (move.when - last) / CYCLES_PER_US : 0);
+				last = move.when;
 				consoleWriteTxBuf();
 			}
 		}
 	}
+	encoderDebugListen(false);
 	
 	return pdFALSE;
 }
 
+// Command to measure the encoder interrupt
+static portBASE_TYPE encoderCyclesCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	// scan through command then whitespace to seconds param
+	int8_t const *p = findNextParam(pcCommandString);
+	int seconds = parseInt(p, 0);
+	if (seconds < 0 || seconds > 30) {
+		consoleWrite(MSG_SECONDS_NOT_VALID);
+		return pdFALSE;
+	}
+	
+	encoderCyclesReset();
+	vTaskDelay(MS_TO_TICKS(seconds * 1000));
+	uint32_t calls;
+	StageCycles const *cycles = encoderCycles(&calls);
+	uint32_t avg = calls ? cycles->total / calls : 0;
+	snprintf((char *) txBuf, txBufSize, "%lu interrupts, avg %lu max %lu cycles\r\n",
+		calls, avg, cycles->max);
+	consoleWriteTxBuf();
+	return pdFALSE;
+}
+
+// Show or set encoder acceleration
+static portBASE_TYPE encoderAccelCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	EncoderAccel a;
+	int8_t const *p = findNextParam(pcCommandString);
+	if (*p) {
+		int threshold = parseInt(p, 0);
+		p = findNextParam(p);
+		int gain = parseInt(p, 0);
+		p = findNextParam(p);
+		int maxSteps = parseInt(p, 0);
+		if (threshold < 0 || threshold > 1000 || gain < 0 || gain > 255 ||
+				maxSteps < 1 || maxSteps > 255) {
+			consoleWrite(MSG_ACCEL_USAGE);
+			return pdFALSE;
+		}
+		a.threshold = threshold;
+		a.gain = gain;
+		a.maxSteps = maxSteps;
+		encoderAccelSet(&a);
+	}
+	
+	encoderAccelGet(&a);
+	snprintf((char *) txBuf, txBufSize, 
+		"Over %u detents/s, 1 + %u/16 steps per detent/s, up to %u steps\r\n",
+		a.threshold, a.gain, a.maxSteps);
+	consoleWriteTxBuf();
+	return pdFALSE;
+}
+
+// Show encoder detent types, or detect them again
+static portBASE_TYPE encoderDetectCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	int8_t const *p = findNextParam(pcCommandString);
+	if (*p == 'r') {
+		encoderDetectAgain();
+	}
+	
+	for (int i = 0; i < NUM_ENCODERS; i++) {
+		EncoderState const *encoder = encoderStates + i;
+		if (encoder->detecting) {
+			snprintf((char *) txBuf, txBufSize, "%d: type %c, detecting (%d rests at 00, %d at 11)\r\n",
+				i, encoderType(i), encoder->restsLow, encoder->restsHigh);
+		} else {
+			snprintf((char *) txBuf, txBufSize, "%d: type %c\r\n", i, encoderType(i));
+		}
+		consoleWriteTxBuf();
+	}
+	return pdFALSE;
+}
+
 // Command to dump spi pot
 static portBASE_TYPE potDumpCommand(
 int8_t *pcWriteBuffer,
@@ -580,9 +726,13 @@ const int8_t *pcCommandString) {
 	
 	p = findNextParam(p);
 	int hz = parseInt(p, 0);
+	if (hz < 0 || hz >= AUDIO_SAMPLE_RATE / 2) {
+		consoleWrite(MSG_INVALID_HZ);
+		return pdFALSE;
+	}
 	
-	audioModeSet(mode);
-	audioFrequencySet(hz);
+	// Mode and frequency change together
+	audioSet(mode, hz << 16, audioParams()->volume);
 	
 	return pdFALSE;
 }
@@ -600,12 +750,628 @@ const int8_t *pcCommandString) {
 		consoleWrite(MSG_INVALID_VOLUME);
 		return pdFALSE;
 	}
-	audioVolume = vol;
+	audioVolumeSet(vol);
+	
+	return pdFALSE;
+}
+
+// Audio output quantization command
+static portBASE_TYPE audioQuantizationCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	// scan through command, then through whitespace to flags
+	int8_t const *p = findNextParam(pcCommandString);
+	int shaping = parseInt(p, 0);
+	p = findNextParam(p);
+	int dither = parseInt(p, 0);
+	if (shaping < 0 || shaping > 1 || dither < 0 || dither > 1) {
+		consoleWrite(MSG_INVALID_FLAG);
+		return pdFALSE;
+	}
+	audioQuantizationSet(shaping, dither);
+	
+	return pdFALSE;
+}
+
+// Silence gate command. With no params, shows the gate settings and state.
+static portBASE_TYPE audioGateCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	int8_t const *p = findNextParam(pcCommandString);
+	if (*p) {
+		int enabled = parseInt(p, 0);
+		p = findNextParam(p);
+		int threshold = parseInt(p, 0);
+		p = findNextParam(p);
+		int hold = parseInt(p, 0);
+		if (enabled < 0 || enabled > 1 || threshold < 0 || threshold > 90 ||
+			hold < 1 || hold > 60000) {
+			consoleWrite(MSG_GATE_USAGE);
+			return pdFALSE;
+		}
+		audioGateSet(enabled, threshold, hold);
+	}
+	
+	AudioParams const *params = audioParams();
+	snprintf((char *) txBuf, txBufSize, "Gate %s, threshold %ld, hold %lums: %s\r\n",
+		params->gateEnabled ? "enabled" : "disabled", params->gateThreshold,
+		params->gateHoldSamples / (AUDIO_SAMPLE_RATE / 1000),
+		audioGateIsOpen() ? "open" : "gated");
+	consoleWriteTxBuf();
+	return pdFALSE;
+}
+
+// Drive tracking command. Shows average carrier drive since last time.
+static portBASE_TYPE driveTrackingCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	int8_t const *p = findNextParam(pcCommandString);
+	if (*p) {
+		int enabled = parseInt(p, 0);
+		p = findNextParam(p);
+		int floor = parseInt(p, 0);
+		if (enabled < 0 || enabled > 1 || floor < 1 || floor > 100) {
+			consoleWrite(MSG_DRIVE_USAGE);
+			return pdFALSE;
+		}
+		audioEnvelopeTrackingSet(enabled, floor);
+	}
+	
+	uint32_t samples;
+	uint32_t drive = audioDriveTake(&samples);
+	snprintf((char *) txBuf, txBufSize, "Tracking %s. Average drive %lu.%lu%% over %lu samples\r\n",
+		audioParams()->envelopeTracking ? "on" : "off", drive / 10, drive % 10, samples);
+	consoleWriteTxBuf();
+	return pdFALSE;
+}
+
+// Audio chain command. Lists stages of the active chain with estimated and
+// measured cycles.
+static portBASE_TYPE audioChainCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	static char const *const kinds[] = {"source", "filter", "gain", "modulator", "sink"};
+	AudioChain const *chain = &audioParams()->chain;
+	if (!chain->numStages) {
+		consoleWrite(MSG_NO_CHAIN);
+		return pdFALSE;
+	}
+	
+	uint32_t samples;
+	StageCycles const *cycles = chainCycles(&samples);
+	snprintf((char *) txBuf, txBufSize, "Stage     Kind       Est  Avg  Max  (%lu samples)\r\n", samples);
+	consoleWriteTxBuf();
+	for (int i = 0; i < chain->numStages; i++) {
+		AudioStage const *stage = chain->stages[i];
+		uint32_t avg = samples ? cycles[i].total / samples : 0;
+		snprintf((char *) txBuf, txBufSize, "%-9s %-9s %4lu %4lu %4lu\r\n", 
+			stage->name, kinds[stage->kind], stage->cycles, avg, cycles[i].max);
+		consoleWriteTxBuf();
+	}
+	snprintf((char *) txBuf, txBufSize, "Estimated %lu of %lu cycles\r\n", 
+		chain->cycles, (uint32_t) CHAIN_CYCLE_BUDGET);
+	consoleWriteTxBuf();
+	
+	return pdFALSE;
+}
+
+// Audio envelope command
+static portBASE_TYPE audioEnvelopeCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	// attack, decay, sustain, release
+	int8_t const *p = findNextParam(pcCommandString);
+	int attack = parseInt(p, 0);
+	p = findNextParam(p);
+	int decay = parseInt(p, 0);
+	p = findNextParam(p);
+	int sustain = parseInt(p, 0);
+	p = findNextParam(p);
+	int release = parseInt(p, 0);
+	
+	if (attack < 0 || attack > 5000 || decay < 0 || decay > 5000 ||
+			release < 0 || release > 5000) {
+		consoleWrite(MSG_INVALID_ENVELOPE_TIME);
+		return pdFALSE;
+	}
+	if (sustain < 0 || sustain > 255) {
+		consoleWrite(MSG_INVALID_SUSTAIN);
+		return pdFALSE;
+	}
+	
+	EnvelopeParams env = {
+		.attackMs = attack,
+		.decayMs = decay,
+		.sustain = sustain,
+		.releaseMs = release,
+	};
+	synthEnvelopeSet(&env);
 	
 	return pdFALSE;
 }
 
+// List clips command
+static portBASE_TYPE clipListCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	for (int i = 0; clips[i]; i++) {
+		snprintf((char *) txBuf, txBufSize, "%d: %s %luHz %lu samples\r\n", 
+			i, clips[i]->name, (uint32_t) clips[i]->sampleRate, clips[i]->numSamples);
+		consoleWriteTxBuf();
+	}
 	
+	return pdFALSE;
+}
+
+// Play clip command
+static portBASE_TYPE clipPlayCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	// scan through command, then through whitespace to clip number
+	int8_t const *p = findNextParam(pcCommandString);
+	int num = parseInt(p, 0);
+	int count = 0;
+	while (clips[count]) {
+		count++;
+	}
+	if (num < 0 || num >= count) {
+		consoleWrite(MSG_INVALID_CLIP);
+		return pdFALSE;
+	}
+	
+	p = findNextParam(p);
+	int loop = parseInt(p, 0);
+	
+	audioModeSet(AM_CLIP);
+	clipStart(clips[num], loop > 0);
+	
+	return pdFALSE;
+}
+
+	
+
+// True if p starts with word w, followed by a space or end of string
+static bool paramIs(int8_t const *p, char const *w) {
+	size_t len = strlen(w);
+	return strncmp((char const *) p, w, len) == 0 && (p[len] == '\0' || p[len] == ' ');
+}
+
+// Signal generator command
+static portBASE_TYPE signalGenerateCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	// scan through command, then through whitespace to signal type
+	int8_t const *p = findNextParam(pcCommandString);
+	SignalParams params;
+	memset(&params, 0, sizeof(params));
+	bool valid = false;
+	
+	if (paramIs(p, "sweep")) {
+		params.type = SIG_SWEEP;
+		p = findNextParam(p);
+		int f0 = parseInt(p, 0);
+		p = findNextParam(p);
+		int f1 = parseInt(p, 0);
+		p = findNextParam(p);
+		int ms = parseInt(p, 0);
+		valid = f0 > 0 && f0 < AUDIO_SAMPLE_RATE / 2 && f1 > 0 && 
+			f1 < AUDIO_SAMPLE_RATE / 2 && ms > 0 && ms <= 60000;
+		params.freq[0] = f0;
+		params.freq[1] = f1;
+		params.sweepSamples = ms * (AUDIO_SAMPLE_RATE / 1000);
+		valid = valid && siggenSweepValid(f0, f1, params.sweepSamples);
+	} else if (paramIs(p, "mls")) {
+		params.type = SIG_MLS;
+		p = findNextParam(p);
+		int order = parseInt(p, 0);
+		p = findNextParam(p);
+		int seed = parseInt(p, 0);
+		valid = order >= 4 && order <= 16 && seed >= 0;
+		params.mlsOrder = order;
+		params.seed = seed;
+	} else if (paramIs(p, "pink")) {
+		params.type = SIG_PINK;
+		p = findNextParam(p);
+		int seed = parseInt(p, 0);
+		valid = seed >= 0;
+		params.seed = seed;
+	} else if (paramIs(p, "tones")) {
+		params.type = SIG_TONES;
+		p = findNextParam(p);
+		int seed = parseInt(p, 0);
+		valid = seed >= 0;
+		params.seed = seed;
+		int i;
+		for (i = 0; i < SIGGEN_MAX_TONES && *(p = findNextParam(p)); i++) {
+			int f = parseInt(p, 0);
+			if (f <= 0 || f >= AUDIO_SAMPLE_RATE / 2) {
+				valid = false;
+			}
+			params.freq[i] = f;
+		}
+		valid = valid && i > 0;
+	}
+	
+	if (!valid) {
+		consoleWrite(MSG_SIGGEN_USAGE);
+		return pdFALSE;
+	}
+	
+	audioModeSet(AM_SIGGEN);
+	siggenStart(&params);
+	return pdFALSE;
+}
+
+// Frequency response measurement command.
+// Prints "H hz centiDb" for each measured bin, then "h n value" for the
+// start of the impulse response, scaled by 10000.
+static portBASE_TYPE frequencyResponseCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	int8_t const *p = findNextParam(pcCommandString);
+	int f0 = parseInt(p, 0);
+	p = findNextParam(p);
+	int f1 = parseInt(p, 0);
+	p = findNextParam(p);
+	int periods = parseInt(p, 0);
+	p = findNextParam(p);
+	int chan = parseInt(p, 0);
+	if (f0 <= 0 || f1 <= f0 || f1 >= AUDIO_SAMPLE_RATE / 2 || 
+		periods < 1 || periods > 64 || chan < 0 || chan > 15) {
+		consoleWrite(MSG_MEASURE_USAGE);
+		return pdFALSE;
+	}
+	
+	if (!measureRun(f0, f1, periods, chan)) {
+		consoleWrite(MSG_MEASURE_FAILED);
+		return pdFALSE;
+	}
+	
+	float32_t const *db = measureMagnitudeDb();
+	for (int i = 1; i < MEASURE_LEN / 2; i++) {
+		if (db[i] == MEASURE_NO_DATA) {
+			continue;
+		}
+		snprintf((char *) txBuf, txBufSize, "H %lu %ld\r\n", 
+			(uint32_t) (i * AUDIO_SAMPLE_RATE / MEASURE_LEN), (int32_t) (db[i] * 100));
+		consoleWriteTxBuf();
+	}
+	
+	float32_t const *impulse = measureImpulse();
+	for (int i = 0; i < MEASURE_LEN / 4; i++) {
+		snprintf((char *) txBuf, txBufSize, "h %d %ld\r\n", 
+			i, (int32_t) (impulse[i] * 10000));
+		consoleWriteTxBuf();
+	}
+	return pdFALSE;
+}
+
+// Spectrum command. Prints the latest bands.
+static portBASE_TYPE spectrumCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	int8_t levels[SPECTRUM_BANDS];
+	uint32_t frames = spectrumGet(levels);
+	for (int b = 0; b < SPECTRUM_BANDS; b++) {
+		// Bar of one # per 3dB above the floor
+		int n = snprintf((char *) txBuf, txBufSize, "%5luHz %4ddB ", spectrumBandHz(b), levels[b]);
+		for (int i = -SPECTRUM_FLOOR_DB; i < levels[b]; i += 3) {
+			txBuf[n++] = '#';
+		}
+		strcpy((char *) txBuf + n, CRLF);
+		consoleWriteTxBuf();
+	}
+	snprintf((char *) txBuf, txBufSize, "%lu blocks, %lu cycles per block\r\n", 
+		frames, spectrumCycles());
+	consoleWriteTxBuf();
+	return pdFALSE;
+}
+
+// Temperament command. With no param, lists temperaments.
+static portBASE_TYPE noteTemperamentCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	int8_t const *p = findNextParam(pcCommandString);
+	if (*p) {
+		int t = parseInt(p, 0);
+		if (t < 0 || t >= NUM_TEMPERAMENTS) {
+			consoleWrite(MSG_INVALID_TEMPERAMENT);
+			return pdFALSE;
+		}
+		noteTemperamentSet(t);
+	}
+	
+	for (int t = 0; t < NUM_TEMPERAMENTS; t++) {
+		snprintf((char *) txBuf, txBufSize, "%c %d: %s\r\n", 
+			t == noteTemperamentGet() ? '*' : ' ', t, temperamentNames[t]);
+		consoleWriteTxBuf();
+	}
+	return pdFALSE;
+}
+
+// Note detune command. Detune is shown for each note of the scale, with
+// the resulting frequency in octave 4.
+static portBASE_TYPE noteDetuneCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	int8_t const *p = findNextParam(pcCommandString);
+	if (*p) {
+		int n = parseInt(p, 0);
+		p = findNextParam(p);
+		// parseInt rejects negative numbers
+		bool negative = *p == '-';
+		int cents = parseInt(negative ? p + 1 : p, 0);
+		if (n < 0 || n > 11 || cents < 0 || cents > 100) {
+			consoleWrite(MSG_INVALID_DETUNE);
+			return pdFALSE;
+		}
+		noteDetuneSet(n, negative ? -cents : cents);
+	}
+	
+	for (int n = 0; n < 12; n++) {
+		char name[4];
+		uint8_t note = 0x40 + n;
+		noteToName(note, name);
+		uint32_t hz = noteToFrequency(note);
+		snprintf((char *) txBuf, txBufSize, "%2d %-3s %4d cents %5lu.%03luHz\r\n", 
+			n, name, noteDetuneGet(n), hz >> 16, ((hz & 0xffff) * 1000) >> 16);
+		consoleWriteTxBuf();
+	}
+	return pdFALSE;
+}
+
+// Show or set player tempo and transpose
+static portBASE_TYPE playerTempoCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	int8_t const *p = findNextParam(pcCommandString);
+	if (*p) {
+		int percent = parseInt(p, 0);
+		p = findNextParam(p);
+		// parseInt rejects negative numbers
+		bool negative = *p == '-';
+		int semitones = parseInt(negative ? p + 1 : p, 0);
+		uint32_t t = percent * PLAYER_TEMPO_UNITY / 100;
+		if (percent < 0 || t < PLAYER_TEMPO_MIN || t > PLAYER_TEMPO_MAX || 
+				semitones < 0 || semitones > PLAYER_TRANSPOSE_MAX) {
+			consoleWrite(MSG_INVALID_TEMPO);
+			return pdFALSE;
+		}
+		playerTempoSet(t);
+		playerTransposeSet(negative ? -semitones : semitones);
+	}
+	
+	snprintf((char *) txBuf, txBufSize, "Tempo %lu%%, transpose %d semitones\r\n",
+		(uint32_t) playerTempoGet() * 100 / PLAYER_TEMPO_UNITY, playerTransposeGet());
+	consoleWriteTxBuf();
+	return pdFALSE;
+}
+
+// Play a tune from RAM or flash
+static void cliPlayTune(uint8_t const *tune) {
+	audioModeSet(AM_HZ);
+	audioFrequencySet(0);
+	playerStart(tune);
+}
+
+// Report how an upload went
+static void writeUploadResult(UploadResult r, bool stored, uint32_t len) {
+	if (r != UPLOAD_OK) {
+		snprintf((char *) txBuf, txBufSize, "Upload failed: %s\r\n", UPLOAD_RESULTS[r]);
+		consoleWriteTxBuf();
+	} else if (!stored) {
+		consoleWrite(MSG_UPLOAD_BAD_DATA);
+	} else {
+		snprintf((char *) txBuf, txBufSize, "Stored %lu bytes\r\n", len);
+		consoleWriteTxBuf();
+	}
+}
+
+// Receive a tune over the UART into a RAM slot
+static portBASE_TYPE tuneUploadCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	int slot = parseInt(findNextParam(pcCommandString), 0);
+	if (slot < 0 || slot >= STORE_RAM_SLOTS) {
+		consoleWrite(MSG_INVALID_SLOT);
+		return pdFALSE;
+	}
+	
+	// The slot may be playing
+	playerStop();
+	vTaskDelay(MS_TO_TICKS(2));
+	storeTuneBegin(slot);
+	consoleWrite(MSG_UPLOAD_READY);
+	UploadResult r = uploadReceive(storeTuneAppend);
+	bool stored = r == UPLOAD_OK && storeTuneEnd();
+	uint32_t len = 0;
+	storeTuneGet(slot, &len);
+	writeUploadResult(r, stored, len);
+	return pdFALSE;
+}
+
+// Play the tune in a RAM slot, or stop
+static portBASE_TYPE tunePlayCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	int8_t const *p = findNextParam(pcCommandString);
+	if (!*p) {
+		playerStop();
+		return pdFALSE;
+	}
+	int slot = parseInt(p, 0);
+	if (slot < 0 || slot >= STORE_RAM_SLOTS) {
+		consoleWrite(MSG_INVALID_SLOT);
+		return pdFALSE;
+	}
+	uint8_t const *tune = storeTuneGet(slot, NULL);
+	if (!tune) {
+		consoleWrite(MSG_EMPTY_SLOT);
+		return pdFALSE;
+	}
+	cliPlayTune(tune);
+	return pdFALSE;
+}
+
+// List the RAM tune slots
+static portBASE_TYPE tuneListCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	for (int slot = 0; slot < STORE_RAM_SLOTS; slot++) {
+		uint32_t len;
+		uint8_t const *tune = storeTuneGet(slot, &len);
+		if (tune) {
+			snprintf((char *) txBuf, txBufSize, "%d %5lu bytes %d voices\r\n",
+				slot, len, tuneVoices(tune));
+		} else {
+			snprintf((char *) txBuf, txBufSize, "%d empty\r\n", slot);
+		}
+		consoleWriteTxBuf();
+	}
+	return pdFALSE;
+}
+
+// Receive a tune or clip over the UART into a library slot
+static portBASE_TYPE libraryUploadCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	int8_t const *p = findNextParam(pcCommandString);
+	LibraryKind kind = *p == 't' ? LIBRARY_TUNE : LIBRARY_CLIP;
+	bool kindValid = (*p == 't' || *p == 'c') && (p[1] == ' ' || !p[1]);
+	p = findNextParam(p);
+	int slot = parseInt(p, 0);
+	
+	// Name runs to the next space
+	p = findNextParam(p);
+	char name[LIBRARY_NAME_MAX];
+	int n = 0;
+	while (p[n] && p[n] != ' ' && n < LIBRARY_NAME_MAX - 1) {
+		name[n] = p[n];
+		n++;
+	}
+	name[n] = '\0';
+	
+	p = findNextParam(p);
+	int32_t len = parseInt(p, 0);
+	p = findNextParam(p);
+	int32_t rate = kind == LIBRARY_CLIP ? parseInt(p, 0) : 0;
+	if (!kindValid || slot < 0 || slot >= LIBRARY_SLOTS || n == 0 || len <= 0 ||
+			(kind == LIBRARY_CLIP && (rate <= 0 || rate > AUDIO_SAMPLE_RATE))) {
+		consoleWrite(MSG_LIBRARY_USAGE);
+		return pdFALSE;
+	}
+	flashStoreLock(portMAX_DELAY);
+	if (!libraryBegin(slot, kind, name, len, rate)) {
+		flashStoreUnlock();
+		consoleWrite(MSG_LIBRARY_FULL);
+		return pdFALSE;
+	}
+	
+	consoleWrite(MSG_UPLOAD_READY);
+	UploadResult r = uploadReceive(libraryAppend);
+	bool stored = r == UPLOAD_OK && libraryEnd();
+	flashStoreUnlock();
+	writeUploadResult(r, stored, len);
+	return pdFALSE;
+}
+
+// List the library
+static portBASE_TYPE libraryListCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	flashStoreLock(portMAX_DELAY);
+	for (int slot = 0; slot < LIBRARY_SLOTS; slot++) {
+		LibraryEntry const *e = libraryEntry(slot);
+		if (!e) {
+			continue;
+		}
+		snprintf((char *) txBuf, txBufSize, "%2d %-4s %-15s %6lu bytes at %05lx %s\r\n",
+			slot, e->kind == LIBRARY_TUNE ? "tune" : "clip", e->name,
+			e->length, e->offset, libraryVerify(e) ? MSG_OK : MSG_ERROR);
+		consoleWriteTxBuf();
+	}
+	snprintf((char *) txBuf, txBufSize, "Largest free space %lu bytes\r\n", libraryFree());
+	flashStoreUnlock();
+	consoleWriteTxBuf();
+	return pdFALSE;
+}
+
+// Play a library slot
+static portBASE_TYPE libraryPlayCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	// Once playing, the store is not written until playback stops
+	int8_t const *p = findNextParam(pcCommandString);
+	flashStoreLock(portMAX_DELAY);
+	LibraryEntry const *e = libraryEntry(parseInt(p, 0));
+	if (!e) {
+		flashStoreUnlock();
+		consoleWrite(MSG_EMPTY_SLOT);
+		return pdFALSE;
+	}
+	if (e->kind == LIBRARY_TUNE) {
+		cliPlayTune(libraryData(e));
+	} else {
+		int loop = parseInt(findNextParam(p), 0);
+		audioModeSet(AM_CLIP);
+		clipStart((Clip const *) libraryData(e), loop > 0);
+	}
+	flashStoreUnlock();
+	return pdFALSE;
+}
+
+// Delete a library slot
+static portBASE_TYPE libraryDeleteCommand(
+int8_t *pcWriteBuffer,
+size_t xWriteBufferLen,
+const int8_t *pcCommandString) {
+	
+	flashStoreLock(portMAX_DELAY);
+	bool deleted = libraryDelete(parseInt(findNextParam(pcCommandString), 0));
+	flashStoreUnlock();
+	if (!deleted) {
+		consoleWrite(MSG_ERROR);
+	}
+	return pdFALSE;
+}
 
 // All the commands to register
 static CLI_Command_Definition_t allCommands[] = {
@@ -617,9 +1383,15 @@ static CLI_Command_Definition_t allCommands[] = {
 	},
 	{
 		USTR("et"),
-		USTR("et n s: Track encoder n for s seconds.\r\n"),
+		USTR("et s: Capture encoder edges for s seconds, then dump them in binary for scripts/edges.py.\r\n"),
 		encoderTrackCommand,
-		2
+		1
+	},
+	{
+		USTR("es"),
+		USTR("es n: Show encoder n's state and recent changes.\r\n"),
+		encoderStateCommand,
+		1
 	},
 	{
 		USTR("el"),
@@ -627,6 +1399,24 @@ static CLI_Command_Definition_t allCommands[] = {
 		encoderListenCommand,
 		1
 	},
+	{
+		USTR("ec"),
+		USTR("ec s: Measure encoder interrupt cycles over s seconds.\r\n"),
+		encoderCyclesCommand,
+		1
+	},
+	{
+		USTR("ea"),
+		USTR("ea [t g m]: Show encoder acceleration, or accelerate over t detents/s by g/16 steps per detent/s, up to m steps.\r\n"),
+		encoderAccelCommand,
+		-1
+	},
+	{
+		USTR("ed"),
+		USTR("ed [r]: Show encoder detent types, or r to detect them again.\r\n"),
+		encoderDetectCommand,
+		-1
+	},
 	{
 		USTR("pl"),
 		USTR("pl: Lists value of all pot registers.\r\n"),
@@ -665,7 +1455,7 @@ static CLI_Command_Definition_t allCommands[] = {
 	},
 	{
 		USTR("as"),
-		USTR("as mode freq: Set audioMode to mode and freq to freq.\r\n"),
+		USTR("as mode freq: Set audioMode to mode (0 off, 1 ADC, 2 Hz) and freq to freq.\r\n"),
 		audioSetCommand,
 		2
 	},
@@ -675,6 +1465,126 @@ static CLI_Command_Definition_t allCommands[] = {
 		audioVolumeCommand,
 		1
 	},
+	{
+		USTR("aq"),
+		USTR("aq s d: Turn PWM noise shaping (s) and DACC dither (d) on (1) or off (0).\r\n"),
+		audioQuantizationCommand,
+		2
+	},
+	{
+		USTR("gt"),
+		USTR("gt [e t h]: Show silence gate, or enable (e), set threshold to t dB below full scale and hold to h ms.\r\n"),
+		audioGateCommand,
+		-1
+	},
+	{
+		USTR("dt"),
+		USTR("dt [e f]: Show average carrier drive since last dt, or enable (e) envelope tracking down to f% drive.\r\n"),
+		driveTrackingCommand,
+		-1
+	},
+	{
+		USTR("ac"),
+		USTR("ac: List audio chain stages and their cycle counts.\r\n"),
+		audioChainCommand,
+		0
+	},
+	{
+		USTR("ae"),
+		USTR("ae a d s r: Set envelope attack, decay, release (ms) and sustain (0-255).\r\n"),
+		audioEnvelopeCommand,
+		4
+	},
+	{
+		USTR("cl"),
+		USTR("cl: List clips.\r\n"),
+		clipListCommand,
+		0
+	},
+	{
+		USTR("cp"),
+		USTR("cp n l: Play clip n. Loops until audio mode changes if l is 1.\r\n"),
+		clipPlayCommand,
+		2
+	},
+	{
+		USTR("sg"),
+		USTR("sg type [params]: Generate test signal. sg alone for usage.\r\n"),
+		signalGenerateCommand,
+		-1
+	},
+	{
+		USTR("fr"),
+		USTR("fr f0 f1 p c: Measure frequency response to ADC channel c, sweeping f0-f1Hz p times.\r\n"),
+		frequencyResponseCommand,
+		4
+	},
+	{
+		USTR("sa"),
+		USTR("sa: Show spectrum of audio input.\r\n"),
+		spectrumCommand,
+		0
+	},
+	{
+		USTR("nt"),
+		USTR("nt [t]: List temperaments, or select temperament t.\r\n"),
+		noteTemperamentCommand,
+		-1
+	},
+	{
+		USTR("nd"),
+		USTR("nd [n c]: Show note detune, or detune note n (0-11) by c cents.\r\n"),
+		noteDetuneCommand,
+		-1
+	},
+	{
+		USTR("pt"),
+		USTR("pt [t s]: Show tune tempo and transpose, or set tempo to t% and transpose by s semitones.\r\n"),
+		playerTempoCommand,
+		-1
+	},
+	{
+		USTR("tu"),
+		USTR("tu s: Upload a tune to RAM slot s. Send with upload.py.\r\n"),
+		tuneUploadCommand,
+		1
+	},
+	{
+		USTR("tp"),
+		USTR("tp [s]: Play the tune in RAM slot s, or stop.\r\n"),
+		tunePlayCommand,
+		-1
+	},
+	{
+		USTR("tl"),
+		USTR("tl: List RAM tune slots.\r\n"),
+		tuneListCommand,
+		0
+	},
+	{
+		USTR("lu"),
+		USTR("lu t|c s name n [rate]: Upload an n byte tune or clip to library slot s. Send with upload.py.\r\n"),
+		libraryUploadCommand,
+		-1
+	},
+	{
+		USTR("ll"),
+		USTR("ll: List the library.\r\n"),
+		libraryListCommand,
+		0
+	},
+	{
+		USTR("lp"),
+		USTR("lp s [l]: Play library slot s. Clips loop if l is 1.\r\n"),
+		libraryPlayCommand,
+		-1
+	},
+	{
+		USTR("ld"),
+		USTR("ld s: Delete library slot s.\r\n"),
+		libraryDeleteCommand,
+		1
+	},
 	{
 		USTR("tasks"),
 		USTR("tasks: Lists each task, along with basic stats about the task.\r\n"),
@@ -0,0 +1,154 @@
+// clip.c
+//
+// Plays short IMA-ADPCM compressed clips directly from flash.
+//
+// Clips are generated by make_clips.py. They are usually stored at a lower
+// sample rate than the audio interrupt runs at, so one 4 bit code is decoded
+// every few samples and the output is linearly interpolated in between. The
+// decoder is only a few shifts and adds, so runs comfortably at 40kHz.
+
+#include "decls.h"
+
+// IMA-ADPCM step sizes. Must match make_clips.py
+static int16_t const stepTable[89] = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+	19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+	50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+	130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+	337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+	876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+	2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+	5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+	15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+// Change in step index for each code
+static int8_t const indexTable[16] = {
+	-1, -1, -1, -1, 2, 4, 6, 8,
+	-1, -1, -1, -1, 2, 4, 6, 8,
+};
+
+// Requests from tasks. Cleared by the audio interrupt.
+static Clip const *volatile startRequest;
+static volatile uint32_t startIncrement;
+static volatile bool startLoop;
+static volatile bool stopRequest;
+
+// Decoder state. Owner: audio interrupt.
+static struct {
+	// Clip being played, or NULL
+	Clip const *clip;
+	bool loop;
+
+	// Index of the next code to decode
+	uint32_t index;
+
+	// Position between previous and current decoded samples, 16 bit fraction.
+	// Advanced by increment each output sample.
+	uint32_t position;
+	uint32_t increment;
+
+	// ADPCM decoder state
+	int32_t predictor;
+	int32_t stepIndex;
+
+	// Last two decoded samples, for interpolation
+	int32_t previous;
+	int32_t current;
+} decoder;
+
+// Start playing a clip. If loop is set, plays until stopped.
+void clipStart(Clip const *clip, bool loop) {
+	stopRequest = false;
+	startIncrement = ((uint32_t) clip->sampleRate << 16) / AUDIO_SAMPLE_RATE;
+	startLoop = loop;
+	startRequest = clip;
+}
+
+// Whether a clip is playing. Only AM_CLIP runs the decoder, so a clip left
+// behind by a mode change is stopped even though the decoder still holds it.
+bool clipIsPlaying(void) {
+	return audioModeActive(AM_CLIP) && (decoder.clip != NULL || startRequest != NULL);
+}
+
+// Rewind to the start of the current clip
+static void clipRewind(void) {
+	decoder.index = 0;
+	decoder.predictor = 0;
+	decoder.stepIndex = 0;
+}
+
+// Decode the next code of the current clip
+static inline int32_t clipDecode(void) {
+	uint8_t byte = decoder.clip->data[decoder.index >> 1];
+	uint8_t code = (decoder.index & 1) ? byte >> 4 : byte & 0xf;
+	decoder.index++;
+
+	int32_t step = stepTable[decoder.stepIndex];
+	int32_t delta = step >> 3;
+	if (code & 4) {
+		delta += step;
+	}
+	if (code & 2) {
+		delta += step >> 1;
+	}
+	if (code & 1) {
+		delta += step >> 2;
+	}
+	if (code & 8) {
+		delta = -delta;
+	}
+	decoder.predictor = __SSAT(decoder.predictor + delta, 16);
+
+	int32_t stepIndex = decoder.stepIndex + indexTable[code];
+	decoder.stepIndex = min(max(stepIndex, 0), 88);
+
+	return decoder.predictor;
+}
+
+// Produce the next sample of the playing clip, or 0 if none.
+// Executes from within an interrupt
+int32_t clipNextSample(void) {
+	if (stopRequest) {
+		stopRequest = false;
+		decoder.clip = NULL;
+	}
+	if (startRequest) {
+		decoder.clip = startRequest;
+		decoder.increment = startIncrement;
+		decoder.loop = startLoop;
+		startRequest = NULL;
+		clipRewind();
+		decoder.position = 0;
+		decoder.previous = 0;
+		decoder.current = 0;
+	}
+	if (!decoder.clip) {
+		return 0;
+	}
+
+	// Decode as many codes as needed to move past this output sample
+	decoder.position += decoder.increment;
+	while (decoder.position >= 0x10000) {
+		decoder.position -= 0x10000;
+		if (decoder.index >= decoder.clip->numSamples) {
+			if (!decoder.loop) {
+				decoder.clip = NULL;
+				return 0;
+			}
+			clipRewind();
+		}
+		decoder.previous = decoder.current;
+		decoder.current = clipDecode();
+	}
+
+	// Interpolate between the last two decoded samples
+	int32_t fraction = decoder.position >> 1; // 15 bits
+	return decoder.previous + (((decoder.current - decoder.previous) * fraction) >> 15);
+}
+
+// Stop playing
+void clipStop(void) {
+	startRequest = NULL;
+	stopRequest = true;
+}
@@ -0,0 +1,545 @@
+// Generated clips file.
+//
+// The code to generate this file is in make_clips.py. Do not edit by hand -
+// change and re-run the python instead.
+
+#include "decls.h"
+
+// ref1k: 5000 samples at 10000Hz, 2500 bytes (10000 bytes as 16 bit PCM)
+static uint8_t const clip0Data[] = {
+  0x70, 0x77, 0xe7, 0xff, 0xff, 0x56, 0x01, 0xca, 0x9c, 0x28, 0x34, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82,
+  0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda,
+  0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab,
+  0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20,
+  0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35, 0x82, 0xda, 0xab, 0x20, 0x35,
+  0x82, 0xda, 0xab, 0x20,
+};
+static Clip const clip0 = {
+  .name = "ref1k",
+  .sampleRate = 10000,
+  .numSamples = 5000,
+  .data = clip0Data,
+};
+
+// ref440: 5000 samples at 10000Hz, 2500 bytes (10000 bytes as 16 bit PCM)
+static uint8_t const clip1Data[] = {
+  0x70, 0x77, 0x77, 0x77, 0x77, 0xc9, 0xba, 0xab, 0x8a, 0x20, 0x44, 0x34, 0x34, 0x22, 0x00, 0xaa,
+  0xcd, 0xcb, 0xab, 0xaa, 0x00, 0x43, 0x44, 0x24, 0x23, 0x11, 0x99, 0xdb, 0xcc, 0xba, 0xaa, 0x89,
+  0x22, 0x45, 0x43, 0x23, 0x22, 0x90, 0xca, 0xcc, 0xac, 0xab, 0x8a, 0x10, 0x34, 0x35, 0x34, 0x22,
+  0x01, 0xb9, 0xdc, 0xcb, 0xbb, 0x9a, 0x08, 0x42, 0x44, 0x24, 0x23, 0x02, 0xa0, 0xcb, 0xbd, 0xbc,
+  0xaa, 0x89, 0x30, 0x54, 0x43, 0x33, 0x12, 0x91, 0xba, 0xce, 0xbb, 0xbb, 0x9a, 0x28, 0x63, 0x34,
+  0x34, 0x22, 0x82, 0xb8, 0xcc, 0xcc, 0xba, 0x9a, 0x88, 0x32, 0x36, 0x34, 0x23, 0x12, 0x90, 0xbc,
+  0xbe, 0xcb, 0xaa, 0x89, 0x30, 0x53, 0x44, 0x32, 0x22, 0x80, 0xc9, 0xdb, 0xcb, 0xab, 0x9a, 0x18,
+  0x43, 0x35, 0x34, 0x23, 0x01, 0xa8, 0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x32, 0x36, 0x44, 0x22, 0x12,
+  0x90, 0xca, 0xcc, 0xbb, 0xbb, 0x99, 0x21, 0x54, 0x53, 0x32, 0x22, 0x81, 0xb9, 0xcd, 0xcb, 0xab,
+  0x9a, 0x18, 0x42, 0x44, 0x24, 0x23, 0x11, 0xa8, 0xdb, 0xbc, 0xbc, 0xaa, 0x09, 0x31, 0x54, 0x43,
+  0x23, 0x22, 0x90, 0xca, 0xcc, 0xac, 0xab, 0x8a, 0x10, 0x34, 0x35, 0x34, 0x22, 0x01, 0xb9, 0xdc,
+  0xcb, 0xbb, 0x9a, 0x08, 0x42, 0x35, 0x34, 0x23, 0x02, 0xa0, 0xeb, 0xcb, 0xac, 0xaa, 0x89, 0x21,
+  0x44, 0x34, 0x33, 0x13, 0x80, 0xca, 0xbd, 0xad, 0xab, 0x9a, 0x10, 0x53, 0x34, 0x34, 0x22, 0x01,
+  0xb8, 0xcc, 0xcc, 0xba, 0x9a, 0x09, 0x32, 0x45, 0x43, 0x23, 0x12, 0x98, 0xcb, 0xbd, 0xbc, 0xaa,
+  0x8a, 0x21, 0x44, 0x44, 0x32, 0x22, 0x80, 0xc9, 0xdb, 0xcb, 0xab, 0x9a, 0x18, 0x43, 0x35, 0x34,
+  0x23, 0x01, 0xa8, 0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x32, 0x36, 0x44, 0x22, 0x12, 0x90, 0xca, 0xcc,
+  0xbb, 0xbb, 0x99, 0x21, 0x54, 0x53, 0x32, 0x22, 0x81, 0xb9, 0xcd, 0xcb, 0xab, 0x9a, 0x18, 0x42,
+  0x44, 0x24, 0x23, 0x11, 0xa8, 0xdb, 0xbc, 0xbc, 0xaa, 0x09, 0x31, 0x54, 0x43, 0x23, 0x22, 0x90,
+  0xca, 0xcc, 0xac, 0xab, 0x8a, 0x10, 0x34, 0x35, 0x34, 0x22, 0x01, 0xb9, 0xdc, 0xcb, 0xbb, 0x9a,
+  0x08, 0x42, 0x35, 0x34, 0x23, 0x02, 0xa0, 0xeb, 0xcb, 0xac, 0xaa, 0x89, 0x21, 0x44, 0x34, 0x33,
+  0x13, 0x80, 0xca, 0xbd, 0xad, 0xab, 0x9a, 0x10, 0x53, 0x34, 0x34, 0x22, 0x01, 0xb8, 0xcc, 0xcc,
+  0xba, 0x9a, 0x09, 0x32, 0x45, 0x43, 0x23, 0x12, 0x98, 0xcb, 0xbd, 0xbc, 0xaa, 0x8a, 0x21, 0x44,
+  0x44, 0x32, 0x22, 0x80, 0xc9, 0xdb, 0xcb, 0xab, 0x9a, 0x18, 0x43, 0x35, 0x34, 0x23, 0x01, 0xa8,
+  0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x32, 0x36, 0x44, 0x22, 0x12, 0x90, 0xca, 0xcc, 0xbb, 0xbb, 0x99,
+  0x21, 0x54, 0x53, 0x32, 0x22, 0x81, 0xb9, 0xcd, 0xcb, 0xab, 0x9a, 0x18, 0x42, 0x44, 0x24, 0x23,
+  0x11, 0xa8, 0xdb, 0xbc, 0xbc, 0xaa, 0x09, 0x31, 0x54, 0x43, 0x23, 0x22, 0x90, 0xca, 0xcc, 0xac,
+  0xab, 0x8a, 0x10, 0x34, 0x35, 0x34, 0x22, 0x01, 0xb9, 0xdc, 0xcb, 0xbb, 0x9a, 0x08, 0x42, 0x35,
+  0x34, 0x23, 0x02, 0xa0, 0xeb, 0xcb, 0xac, 0xaa, 0x89, 0x21, 0x44, 0x34, 0x33, 0x13, 0x80, 0xca,
+  0xbd, 0xad, 0xab, 0x9a, 0x10, 0x53, 0x34, 0x34, 0x22, 0x01, 0xb8, 0xcc, 0xcc, 0xba, 0x9a, 0x09,
+  0x32, 0x45, 0x43, 0x23, 0x12, 0x98, 0xcb, 0xbd, 0xbc, 0xaa, 0x8a, 0x21, 0x44, 0x44, 0x32, 0x22,
+  0x80, 0xc9, 0xdb, 0xcb, 0xab, 0x9a, 0x18, 0x43, 0x35, 0x34, 0x23, 0x01, 0xa8, 0xdc, 0xcb, 0xbb,
+  0xaa, 0x88, 0x32, 0x36, 0x44, 0x22, 0x12, 0x90, 0xca, 0xcc, 0xbb, 0xbb, 0x99, 0x21, 0x54, 0x53,
+  0x32, 0x22, 0x81, 0xb9, 0xcd, 0xcb, 0xab, 0x9a, 0x18, 0x42, 0x44, 0x24, 0x23, 0x11, 0xa8, 0xdb,
+  0xbc, 0xbc, 0xaa, 0x09, 0x31, 0x54, 0x43, 0x23, 0x22, 0x90, 0xca, 0xcc, 0xac, 0xab, 0x8a, 0x10,
+  0x34, 0x35, 0x34, 0x22, 0x01, 0xb9, 0xdc, 0xcb, 0xbb, 0x9a, 0x08, 0x42, 0x35, 0x34, 0x23, 0x02,
+  0xa0, 0xeb, 0xcb, 0xac, 0xaa, 0x89, 0x21, 0x44, 0x34, 0x33, 0x13, 0x80, 0xca, 0xbd, 0xad, 0xab,
+  0x9a, 0x10, 0x53, 0x34, 0x34, 0x22, 0x01, 0xb8, 0xcc, 0xcc, 0xba, 0x9a, 0x09, 0x32, 0x45, 0x43,
+  0x23, 0x12, 0x98, 0xcb, 0xbd, 0xbc, 0xaa, 0x8a, 0x21, 0x44, 0x44, 0x32, 0x22, 0x80, 0xc9, 0xdb,
+  0xcb, 0xab, 0x9a, 0x18, 0x43, 0x35, 0x34, 0x23, 0x01, 0xa8, 0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x32,
+  0x36, 0x44, 0x22, 0x12, 0x90, 0xca, 0xcc, 0xbb, 0xbb, 0x99, 0x21, 0x54, 0x53, 0x32, 0x22, 0x81,
+  0xb9, 0xcd, 0xcb, 0xab, 0x9a, 0x18, 0x42, 0x44, 0x24, 0x23, 0x11, 0xa8, 0xdb, 0xbc, 0xbc, 0xaa,
+  0x09, 0x31, 0x54, 0x43, 0x23, 0x22, 0x90, 0xca, 0xcc, 0xac, 0xab, 0x8a, 0x10, 0x34, 0x35, 0x34,
+  0x22, 0x01, 0xb9, 0xdc, 0xcb, 0xbb, 0x9a, 0x08, 0x42, 0x35, 0x34, 0x23, 0x02, 0xa0, 0xeb, 0xcb,
+  0xac, 0xaa, 0x89, 0x21, 0x44, 0x34, 0x33, 0x13, 0x80, 0xca, 0xbd, 0xad, 0xab, 0x9a, 0x10, 0x53,
+  0x34, 0x34, 0x22, 0x01, 0xb8, 0xcc, 0xcc, 0xba, 0x9a, 0x09, 0x32, 0x45, 0x43, 0x23, 0x12, 0x98,
+  0xcb, 0xbd, 0xbc, 0xaa, 0x8a, 0x21, 0x44, 0x44, 0x32, 0x22, 0x80, 0xc9, 0xdb, 0xcb, 0xab, 0x9a,
+  0x18, 0x43, 0x35, 0x34, 0x23, 0x01, 0xa8, 0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x32, 0x36, 0x44, 0x22,
+  0x12, 0x90, 0xca, 0xcc, 0xbb, 0xbb, 0x99, 0x21, 0x54, 0x53, 0x32, 0x22, 0x81, 0xb9, 0xcd, 0xcb,
+  0xab, 0x9a, 0x18, 0x42, 0x44, 0x24, 0x23, 0x11, 0xa8, 0xdb, 0xbc, 0xbc, 0xaa, 0x09, 0x31, 0x54,
+  0x43, 0x23, 0x22, 0x90, 0xca, 0xcc, 0xac, 0xab, 0x8a, 0x10, 0x34, 0x35, 0x34, 0x22, 0x01, 0xb9,
+  0xdc, 0xcb, 0xbb, 0x9a, 0x08, 0x42, 0x35, 0x34, 0x23, 0x02, 0xa0, 0xeb, 0xcb, 0xac, 0xaa, 0x89,
+  0x21, 0x44, 0x34, 0x33, 0x13, 0x80, 0xca, 0xbd, 0xad, 0xab, 0x9a, 0x10, 0x53, 0x34, 0x34, 0x22,
+  0x01, 0xb8, 0xcc, 0xcc, 0xba, 0x9a, 0x09, 0x32, 0x45, 0x43, 0x23, 0x12, 0x98, 0xcb, 0xbd, 0xbc,
+  0xaa, 0x8a, 0x21, 0x44, 0x44, 0x32, 0x22, 0x80, 0xc9, 0xdb, 0xcb, 0xab, 0x9a, 0x18, 0x43, 0x35,
+  0x34, 0x23, 0x01, 0xa8, 0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x32, 0x36, 0x44, 0x22, 0x12, 0x90, 0xca,
+  0xcc, 0xbb, 0xbb, 0x99, 0x21, 0x54, 0x53, 0x32, 0x22, 0x81, 0xb9, 0xcd, 0xcb, 0xab, 0x9a, 0x18,
+  0x42, 0x44, 0x24, 0x23, 0x11, 0xa8, 0xdb, 0xbc, 0xbc, 0xaa, 0x09, 0x31, 0x54, 0x43, 0x23, 0x22,
+  0x90, 0xca, 0xcc, 0xac, 0xab, 0x8a, 0x10, 0x34, 0x35, 0x34, 0x22, 0x01, 0xb9, 0xdc, 0xcb, 0xbb,
+  0x9a, 0x08, 0x42, 0x35, 0x34, 0x23, 0x02, 0xa0, 0xeb, 0xcb, 0xac, 0xaa, 0x89, 0x21, 0x44, 0x34,
+  0x33, 0x13, 0x80, 0xca, 0xbd, 0xad, 0xab, 0x9a, 0x10, 0x53, 0x34, 0x34, 0x22, 0x01, 0xb8, 0xcc,
+  0xcc, 0xba, 0x9a, 0x09, 0x32, 0x45, 0x43, 0x23, 0x12, 0x98, 0xcb, 0xbd, 0xbc, 0xaa, 0x8a, 0x21,
+  0x44, 0x44, 0x32, 0x22, 0x80, 0xc9, 0xdb, 0xcb, 0xab, 0x9a, 0x18, 0x43, 0x35, 0x34, 0x23, 0x01,
+  0xa8, 0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x32, 0x36, 0x44, 0x22, 0x12, 0x90, 0xca, 0xcc, 0xbb, 0xbb,
+  0x99, 0x21, 0x54, 0x53, 0x32, 0x22, 0x81, 0xb9, 0xcd, 0xcb, 0xab, 0x9a, 0x18, 0x42, 0x44, 0x24,
+  0x23, 0x11, 0xa8, 0xdb, 0xbc, 0xbc, 0xaa, 0x09, 0x31, 0x54, 0x43, 0x23, 0x22, 0x90, 0xca, 0xcc,
+  0xac, 0xab, 0x8a, 0x10, 0x34, 0x35, 0x34, 0x22, 0x01, 0xb9, 0xdc, 0xcb, 0xbb, 0x9a, 0x08, 0x42,
+  0x35, 0x34, 0x23, 0x02, 0xa0, 0xeb, 0xcb, 0xac, 0xaa, 0x89, 0x21, 0x44, 0x34, 0x33, 0x13, 0x80,
+  0xca, 0xbd, 0xad, 0xab, 0x9a, 0x10, 0x53, 0x34, 0x34, 0x22, 0x01, 0xb8, 0xcc, 0xcc, 0xba, 0x9a,
+  0x09, 0x32, 0x45, 0x43, 0x23, 0x12, 0x98, 0xcb, 0xbd, 0xbc, 0xaa, 0x8a, 0x21, 0x44, 0x44, 0x32,
+  0x22, 0x80, 0xc9, 0xdb, 0xcb, 0xab, 0x9a, 0x18, 0x43, 0x35, 0x34, 0x23, 0x01, 0xa8, 0xdc, 0xcb,
+  0xbb, 0xaa, 0x88, 0x32, 0x36, 0x44, 0x22, 0x12, 0x90, 0xca, 0xcc, 0xbb, 0xbb, 0x99, 0x21, 0x54,
+  0x53, 0x32, 0x22, 0x81, 0xb9, 0xcd, 0xcb, 0xab, 0x9a, 0x18, 0x42, 0x44, 0x24, 0x23, 0x11, 0xa8,
+  0xdb, 0xbc, 0xbc, 0xaa, 0x09, 0x31, 0x54, 0x43, 0x23, 0x22, 0x90, 0xca, 0xcc, 0xac, 0xab, 0x8a,
+  0x10, 0x34, 0x35, 0x34, 0x22, 0x01, 0xb9, 0xdc, 0xcb, 0xbb, 0x9a, 0x08, 0x42, 0x35, 0x34, 0x23,
+  0x02, 0xa0, 0xeb, 0xcb, 0xac, 0xaa, 0x89, 0x21, 0x44, 0x34, 0x33, 0x13, 0x80, 0xca, 0xbd, 0xad,
+  0xab, 0x9a, 0x10, 0x53, 0x34, 0x34, 0x22, 0x01, 0xb8, 0xcc, 0xcc, 0xba, 0x9a, 0x09, 0x32, 0x45,
+  0x43, 0x23, 0x12, 0x98, 0xcb, 0xbd, 0xbc, 0xaa, 0x8a, 0x21, 0x44, 0x44, 0x32, 0x22, 0x80, 0xc9,
+  0xdb, 0xcb, 0xab, 0x9a, 0x18, 0x43, 0x35, 0x34, 0x23, 0x01, 0xa8, 0xdc, 0xcb, 0xbb, 0xaa, 0x88,
+  0x32, 0x36, 0x44, 0x22, 0x12, 0x90, 0xca, 0xcc, 0xbb, 0xbb, 0x99, 0x21, 0x54, 0x53, 0x32, 0x22,
+  0x81, 0xb9, 0xcd, 0xcb, 0xab, 0x9a, 0x18, 0x42, 0x44, 0x24, 0x23, 0x11, 0xa8, 0xdb, 0xbc, 0xbc,
+  0xaa, 0x09, 0x31, 0x54, 0x43, 0x23, 0x22, 0x90, 0xca, 0xcc, 0xac, 0xab, 0x8a, 0x10, 0x34, 0x35,
+  0x34, 0x22, 0x01, 0xb9, 0xdc, 0xcb, 0xbb, 0x9a, 0x08, 0x42, 0x35, 0x34, 0x23, 0x02, 0xa0, 0xeb,
+  0xcb, 0xac, 0xaa, 0x89, 0x21, 0x44, 0x34, 0x33, 0x13, 0x80, 0xca, 0xbd, 0xad, 0xab, 0x9a, 0x10,
+  0x53, 0x34, 0x34, 0x22, 0x01, 0xb8, 0xcc, 0xcc, 0xba, 0x9a, 0x09, 0x32, 0x45, 0x43, 0x23, 0x12,
+  0x98, 0xcb, 0xbd, 0xbc, 0xaa, 0x8a, 0x21, 0x44, 0x44, 0x32, 0x22, 0x80, 0xc9, 0xdb, 0xcb, 0xab,
+  0x9a, 0x18, 0x43, 0x35, 0x34, 0x23, 0x01, 0xa8, 0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x32, 0x36, 0x44,
+  0x22, 0x12, 0x90, 0xca, 0xcc, 0xbb, 0xbb, 0x99, 0x21, 0x54, 0x53, 0x32, 0x22, 0x81, 0xb9, 0xcd,
+  0xcb, 0xab, 0x9a, 0x18, 0x42, 0x44, 0x24, 0x23, 0x11, 0xa8, 0xdb, 0xbc, 0xbc, 0xaa, 0x09, 0x31,
+  0x54, 0x43, 0x23, 0x22, 0x90, 0xca, 0xcc, 0xac, 0xab, 0x8a, 0x10, 0x34, 0x35, 0x34, 0x22, 0x01,
+  0xb9, 0xdc, 0xcb, 0xbb, 0x9a, 0x08, 0x42, 0x35, 0x34, 0x23, 0x02, 0xa0, 0xeb, 0xcb, 0xac, 0xaa,
+  0x89, 0x21, 0x44, 0x34, 0x33, 0x13, 0x80, 0xca, 0xbd, 0xad, 0xab, 0x9a, 0x10, 0x53, 0x34, 0x34,
+  0x22, 0x01, 0xb8, 0xcc, 0xcc, 0xba, 0x9a, 0x09, 0x32, 0x45, 0x43, 0x23, 0x12, 0x98, 0xcb, 0xbd,
+  0xbc, 0xaa, 0x8a, 0x21, 0x44, 0x44, 0x32, 0x22, 0x80, 0xc9, 0xdb, 0xcb, 0xab, 0x9a, 0x18, 0x43,
+  0x35, 0x34, 0x23, 0x01, 0xa8, 0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x32, 0x36, 0x44, 0x22, 0x12, 0x90,
+  0xca, 0xcc, 0xbb, 0xbb, 0x99, 0x21, 0x54, 0x53, 0x32, 0x22, 0x81, 0xb9, 0xcd, 0xcb, 0xab, 0x9a,
+  0x18, 0x42, 0x44, 0x24, 0x23, 0x11, 0xa8, 0xdb, 0xbc, 0xbc, 0xaa, 0x09, 0x31, 0x54, 0x43, 0x23,
+  0x22, 0x90, 0xca, 0xcc, 0xac, 0xab, 0x8a, 0x10, 0x34, 0x35, 0x34, 0x22, 0x01, 0xb9, 0xdc, 0xcb,
+  0xbb, 0x9a, 0x08, 0x42, 0x35, 0x34, 0x23, 0x02, 0xa0, 0xeb, 0xcb, 0xac, 0xaa, 0x89, 0x21, 0x44,
+  0x34, 0x33, 0x13, 0x80, 0xca, 0xbd, 0xad, 0xab, 0x9a, 0x10, 0x53, 0x34, 0x34, 0x22, 0x01, 0xb8,
+  0xcc, 0xcc, 0xba, 0x9a, 0x09, 0x32, 0x45, 0x43, 0x23, 0x12, 0x98, 0xcb, 0xbd, 0xbc, 0xaa, 0x8a,
+  0x21, 0x44, 0x44, 0x32, 0x22, 0x80, 0xc9, 0xdb, 0xcb, 0xab, 0x9a, 0x18, 0x43, 0x35, 0x34, 0x23,
+  0x01, 0xa8, 0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x32, 0x36, 0x44, 0x22, 0x12, 0x90, 0xca, 0xcc, 0xbb,
+  0xbb, 0x99, 0x21, 0x54, 0x53, 0x32, 0x22, 0x81, 0xb9, 0xcd, 0xcb, 0xab, 0x9a, 0x18, 0x42, 0x44,
+  0x24, 0x23, 0x11, 0xa8, 0xdb, 0xbc, 0xbc, 0xaa, 0x09, 0x31, 0x54, 0x43, 0x23, 0x22, 0x90, 0xca,
+  0xcc, 0xac, 0xab, 0x8a, 0x10, 0x34, 0x35, 0x34, 0x22, 0x01, 0xb9, 0xdc, 0xcb, 0xbb, 0x9a, 0x08,
+  0x42, 0x35, 0x34, 0x23, 0x02, 0xa0, 0xeb, 0xcb, 0xac, 0xaa, 0x89, 0x21, 0x44, 0x34, 0x33, 0x13,
+  0x80, 0xca, 0xbd, 0xad, 0xab, 0x9a, 0x10, 0x53, 0x34, 0x34, 0x22, 0x01, 0xb8, 0xcc, 0xcc, 0xba,
+  0x9a, 0x09, 0x32, 0x45, 0x43, 0x23, 0x12, 0x98, 0xcb, 0xbd, 0xbc, 0xaa, 0x8a, 0x21, 0x44, 0x44,
+  0x32, 0x22, 0x80, 0xc9, 0xdb, 0xcb, 0xab, 0x9a, 0x18, 0x43, 0x35, 0x34, 0x23, 0x01, 0xa8, 0xdc,
+  0xcb, 0xbb, 0xaa, 0x88, 0x32, 0x36, 0x44, 0x22, 0x12, 0x90, 0xca, 0xcc, 0xbb, 0xbb, 0x99, 0x21,
+  0x54, 0x53, 0x32, 0x22, 0x81, 0xb9, 0xcd, 0xcb, 0xab, 0x9a, 0x18, 0x42, 0x44, 0x24, 0x23, 0x11,
+  0xa8, 0xdb, 0xbc, 0xbc, 0xaa, 0x09, 0x31, 0x54, 0x43, 0x23, 0x22, 0x90, 0xca, 0xcc, 0xac, 0xab,
+  0x8a, 0x10, 0x34, 0x35, 0x34, 0x22, 0x01, 0xb9, 0xdc, 0xcb, 0xbb, 0x9a, 0x08, 0x42, 0x35, 0x34,
+  0x23, 0x02, 0xa0, 0xeb, 0xcb, 0xac, 0xaa, 0x89, 0x21, 0x44, 0x34, 0x33, 0x13, 0x80, 0xca, 0xbd,
+  0xad, 0xab, 0x9a, 0x10, 0x53, 0x34, 0x34, 0x22, 0x01, 0xb8, 0xcc, 0xcc, 0xba, 0x9a, 0x09, 0x32,
+  0x45, 0x43, 0x23, 0x12, 0x98, 0xcb, 0xbd, 0xbc, 0xaa, 0x8a, 0x21, 0x44, 0x44, 0x32, 0x22, 0x80,
+  0xc9, 0xdb, 0xcb, 0xab, 0x9a, 0x18, 0x43, 0x35, 0x34, 0x23, 0x01, 0xa8, 0xdc, 0xcb, 0xbb, 0xaa,
+  0x88, 0x32, 0x36, 0x44, 0x22, 0x12, 0x90, 0xca, 0xcc, 0xbb, 0xbb, 0x99, 0x21, 0x54, 0x53, 0x32,
+  0x22, 0x81, 0xb9, 0xcd, 0xcb, 0xab, 0x9a, 0x18, 0x42, 0x44, 0x24, 0x23, 0x11, 0xa8, 0xdb, 0xbc,
+  0xbc, 0xaa, 0x09, 0x31, 0x54, 0x43, 0x23, 0x22, 0x90, 0xca, 0xcc, 0xac, 0xab, 0x8a, 0x10, 0x34,
+  0x35, 0x34, 0x22, 0x01, 0xb9, 0xdc, 0xcb, 0xbb, 0x9a, 0x08, 0x42, 0x35, 0x34, 0x23, 0x02, 0xa0,
+  0xeb, 0xcb, 0xac, 0xaa, 0x89, 0x21, 0x44, 0x34, 0x33, 0x13, 0x80, 0xca, 0xbd, 0xad, 0xab, 0x9a,
+  0x10, 0x53, 0x34, 0x34, 0x22, 0x01, 0xb8, 0xcc, 0xcc, 0xba, 0x9a, 0x09, 0x32, 0x45, 0x43, 0x23,
+  0x12, 0x98, 0xcb, 0xbd, 0xbc, 0xaa, 0x8a, 0x21, 0x44, 0x44, 0x32, 0x22, 0x80, 0xc9, 0xdb, 0xcb,
+  0xab, 0x9a, 0x18, 0x43, 0x35, 0x34, 0x23, 0x01, 0xa8, 0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x32, 0x36,
+  0x44, 0x22, 0x12, 0x90, 0xca, 0xcc, 0xbb, 0xbb, 0x99, 0x21, 0x54, 0x53, 0x32, 0x22, 0x81, 0xb9,
+  0xcd, 0xcb, 0xab, 0x9a, 0x18, 0x42, 0x44, 0x24, 0x23, 0x11, 0xa8, 0xdb, 0xbc, 0xbc, 0xaa, 0x09,
+  0x31, 0x54, 0x43, 0x23, 0x22, 0x90, 0xca, 0xcc, 0xac, 0xab, 0x8a, 0x10, 0x34, 0x35, 0x34, 0x22,
+  0x01, 0xb9, 0xdc, 0xcb, 0xbb, 0x9a, 0x08, 0x42, 0x35, 0x34, 0x23, 0x02, 0xa0, 0xeb, 0xcb, 0xac,
+  0xaa, 0x89, 0x21, 0x44, 0x34, 0x33, 0x13, 0x80, 0xca, 0xbd, 0xad, 0xab, 0x9a, 0x10, 0x53, 0x34,
+  0x34, 0x22, 0x01, 0xb8, 0xcc, 0xcc, 0xba, 0x9a, 0x09, 0x32, 0x45, 0x43, 0x23, 0x12, 0x98, 0xcb,
+  0xbd, 0xbc, 0xaa, 0x8a, 0x21, 0x44, 0x44, 0x32, 0x22, 0x80, 0xc9, 0xdb, 0xcb, 0xab, 0x9a, 0x18,
+  0x43, 0x35, 0x34, 0x23, 0x01, 0xa8, 0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x32, 0x36, 0x44, 0x22, 0x12,
+  0x90, 0xca, 0xcc, 0xbb, 0xbb, 0x99, 0x21, 0x54, 0x53, 0x32, 0x22, 0x81, 0xb9, 0xcd, 0xcb, 0xab,
+  0x9a, 0x18, 0x42, 0x44, 0x24, 0x23, 0x11, 0xa8, 0xdb, 0xbc, 0xbc, 0xaa, 0x09, 0x31, 0x54, 0x43,
+  0x23, 0x22, 0x90, 0xca, 0xcc, 0xac, 0xab, 0x8a, 0x10, 0x34, 0x35, 0x34, 0x22, 0x01, 0xb9, 0xdc,
+  0xcb, 0xbb, 0x9a, 0x08, 0x42, 0x35, 0x34, 0x23, 0x02, 0xa0, 0xeb, 0xcb, 0xac, 0xaa, 0x89, 0x21,
+  0x44, 0x34, 0x33, 0x13, 0x80, 0xca, 0xbd, 0xad, 0xab, 0x9a, 0x10, 0x53, 0x34, 0x34, 0x22, 0x01,
+  0xb8, 0xcc, 0xcc, 0xba, 0x9a, 0x09, 0x32, 0x45, 0x43, 0x23, 0x12, 0x98, 0xcb, 0xbd, 0xbc, 0xaa,
+  0x8a, 0x21, 0x44, 0x44, 0x32, 0x22, 0x80, 0xc9, 0xdb, 0xcb, 0xab, 0x9a, 0x18, 0x43, 0x35, 0x34,
+  0x23, 0x01, 0xa8, 0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x32, 0x36, 0x44, 0x22, 0x12, 0x90, 0xca, 0xcc,
+  0xbb, 0xbb, 0x99, 0x21, 0x54, 0x53, 0x32, 0x22, 0x81, 0xb9, 0xcd, 0xcb, 0xab, 0x9a, 0x18, 0x42,
+  0x44, 0x24, 0x23, 0x11, 0xa8, 0xdb, 0xbc, 0xbc, 0xaa, 0x09, 0x31, 0x54, 0x43, 0x23, 0x22, 0x90,
+  0xca, 0xcc, 0xac, 0xab, 0x8a, 0x10, 0x34, 0x35, 0x34, 0x22, 0x01, 0xb9, 0xdc, 0xcb, 0xbb, 0x9a,
+  0x08, 0x42, 0x35, 0x34, 0x23, 0x02, 0xa0, 0xeb, 0xcb, 0xac, 0xaa, 0x89, 0x21, 0x44, 0x34, 0x33,
+  0x13, 0x80, 0xca, 0xbd, 0xad, 0xab, 0x9a, 0x10, 0x53, 0x34, 0x34, 0x22, 0x01, 0xb8, 0xcc, 0xcc,
+  0xba, 0x9a, 0x09, 0x32, 0x45, 0x43, 0x23, 0x12, 0x98, 0xcb, 0xbd, 0xbc, 0xaa, 0x8a, 0x21, 0x44,
+  0x44, 0x32, 0x22, 0x80, 0xc9, 0xdb, 0xcb, 0xab, 0x9a, 0x18, 0x43, 0x35, 0x34, 0x23, 0x01, 0xa8,
+  0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x32, 0x36, 0x44, 0x22, 0x12, 0x90, 0xca, 0xcc, 0xbb, 0xbb, 0x99,
+  0x21, 0x54, 0x53, 0x32, 0x22, 0x81, 0xb9, 0xcd, 0xcb, 0xab, 0x9a, 0x18, 0x42, 0x44, 0x24, 0x23,
+  0x11, 0xa8, 0xdb, 0xbc, 0xbc, 0xaa, 0x09, 0x31, 0x54, 0x43, 0x23, 0x22, 0x90, 0xca, 0xcc, 0xac,
+  0xab, 0x8a, 0x10, 0x34, 0x35, 0x34, 0x22, 0x01, 0xb9, 0xdc, 0xcb, 0xbb, 0x9a, 0x08, 0x42, 0x35,
+  0x34, 0x23, 0x02, 0xa0, 0xeb, 0xcb, 0xac, 0xaa, 0x89, 0x21, 0x44, 0x34, 0x33, 0x13, 0x80, 0xca,
+  0xbd, 0xad, 0xab, 0x9a, 0x10, 0x53, 0x34, 0x34, 0x22, 0x01, 0xb8, 0xcc, 0xcc, 0xba, 0x9a, 0x09,
+  0x32, 0x45, 0x43, 0x23, 0x12, 0x98, 0xcb, 0xbd, 0xbc, 0xaa, 0x8a, 0x21, 0x44, 0x44, 0x32, 0x22,
+  0x80, 0xc9, 0xdb, 0xcb, 0xab, 0x9a, 0x18, 0x43, 0x35, 0x34, 0x23, 0x01, 0xa8, 0xdc, 0xcb, 0xbb,
+  0xaa, 0x88, 0x32, 0x36,
+};
+static Clip const clip1 = {
+  .name = "ref440",
+  .sampleRate = 10000,
+  .numSamples = 5000,
+  .data = clip1Data,
+};
+
+// chime: 6000 samples at 10000Hz, 3000 bytes (12000 bytes as 16 bit PCM)
+static uint8_t const clip2Data[] = {
+  0x70, 0x77, 0xf7, 0xff, 0x10, 0x12, 0x30, 0x46, 0xb1, 0xff, 0x0a, 0x52, 0x23, 0xc9, 0xbb, 0x18,
+  0x22, 0x10, 0x52, 0x03, 0xde, 0xac, 0x41, 0x25, 0x90, 0xcb, 0x89, 0x21, 0x01, 0x10, 0x23, 0xf8,
+  0xbc, 0x29, 0x45, 0x82, 0xba, 0x8c, 0x10, 0x11, 0x00, 0x32, 0xa1, 0xdf, 0x8a, 0x43, 0x14, 0xb8,
+  0xbb, 0x18, 0x12, 0x01, 0x31, 0x04, 0xfb, 0xad, 0x30, 0x35, 0x90, 0xbb, 0x0b, 0x21, 0x11, 0x20,
+  0x24, 0xd8, 0xbe, 0x1a, 0x45, 0x02, 0xc9, 0x9a, 0x28, 0x01, 0x10, 0x31, 0x92, 0xcf, 0x8b, 0x52,
+  0x14, 0xb0, 0xbb, 0x19, 0x12, 0x01, 0x31, 0x23, 0xfc, 0x9d, 0x28, 0x35, 0x91, 0xbb, 0x8b, 0x21,
+  0x02, 0x20, 0x43, 0xd0, 0xcd, 0x1a, 0x63, 0x12, 0xc9, 0x9a, 0x18, 0x11, 0x00, 0x22, 0x82, 0xde,
+  0x9b, 0x52, 0x33, 0xb0, 0xbc, 0x09, 0x21, 0x01, 0x21, 0x23, 0xfa, 0xae, 0x39, 0x44, 0x81, 0xca,
+  0x8a, 0x11, 0x01, 0x10, 0x32, 0xb0, 0xdf, 0x0a, 0x53, 0x03, 0xc8, 0xaa, 0x18, 0x11, 0x01, 0x21,
+  0x83, 0xfc, 0x9c, 0x31, 0x25, 0x90, 0xcb, 0x09, 0x11, 0x01, 0x10, 0x23, 0xe9, 0xbd, 0x29, 0x45,
+  0x82, 0xba, 0x9b, 0x20, 0x11, 0x10, 0x33, 0xb2, 0xff, 0x0a, 0x51, 0x12, 0xa8, 0x9c, 0x19, 0x11,
+  0x00, 0x21, 0x12, 0xec, 0x9c, 0x30, 0x35, 0xa1, 0xcb, 0x0a, 0x11, 0x01, 0x11, 0x23, 0xd8, 0xbf,
+  0x19, 0x35, 0x83, 0xba, 0xac, 0x20, 0x11, 0x10, 0x32, 0xa2, 0xdf, 0x8b, 0x52, 0x14, 0xa8, 0xbb,
+  0x08, 0x12, 0x01, 0x21, 0x14, 0xfb, 0xac, 0x38, 0x26, 0x81, 0xbb, 0x8b, 0x21, 0x02, 0x20, 0x33,
+  0xe0, 0xbe, 0x0a, 0x45, 0x12, 0xba, 0xab, 0x28, 0x12, 0x00, 0x33, 0x83, 0xef, 0x9b, 0x42, 0x24,
+  0xa0, 0xac, 0x09, 0x21, 0x00, 0x11, 0x23, 0xfa, 0xad, 0x28, 0x35, 0x82, 0xdb, 0x8a, 0x11, 0x01,
+  0x10, 0x22, 0xb1, 0xdf, 0x89, 0x53, 0x12, 0xb9, 0xab, 0x18, 0x12, 0x10, 0x41, 0x02, 0xed, 0x9b,
+  0x50, 0x43, 0xa0, 0xbb, 0x0a, 0x12, 0x11, 0x20, 0x14, 0xe8, 0xbd, 0x18, 0x45, 0x01, 0xba, 0x9b,
+  0x20, 0x02, 0x10, 0x33, 0xa1, 0xff, 0x89, 0x32, 0x15, 0xa9, 0xab, 0x08, 0x12, 0x01, 0x21, 0x04,
+  0xfb, 0xac, 0x30, 0x26, 0x91, 0xbb, 0x8a, 0x21, 0x01, 0x11, 0x24, 0xd8, 0xcd, 0x19, 0x44, 0x02,
+  0xba, 0x9c, 0x10, 0x02, 0x10, 0x31, 0xa2, 0xde, 0x8b, 0x52, 0x14, 0xb0, 0xbb, 0x19, 0x12, 0x01,
+  0x31, 0x13, 0xfb, 0xaf, 0x20, 0x34, 0x81, 0xbc, 0x99, 0x21, 0x01, 0x10, 0x33, 0xd0, 0xce, 0x09,
+  0x34, 0x04, 0xb9, 0x9c, 0x10, 0x01, 0x01, 0x21, 0x82, 0xed, 0x9b, 0x42, 0x25, 0x98, 0xac, 0x09,
+  0x12, 0x00, 0x20, 0x22, 0xea, 0xbd, 0x38, 0x35, 0x82, 0xcb, 0x8b, 0x20, 0x11, 0x10, 0x33, 0xb0,
+  0xff, 0x89, 0x43, 0x12, 0xb9, 0xbb, 0x28, 0x12, 0x10, 0x41, 0x02, 0xed, 0xab, 0x51, 0x24, 0x90,
+  0xac, 0x89, 0x21, 0x00, 0x11, 0x23, 0xe9, 0xbd, 0x29, 0x45, 0x82, 0xba, 0x9b, 0x20, 0x11, 0x10,
+  0x42, 0xa1, 0xcf, 0x0b, 0x62, 0x13, 0xb8, 0xac, 0x18, 0x11, 0x00, 0x31, 0x12, 0xfc, 0xab, 0x40,
+  0x34, 0x91, 0xbc, 0x0a, 0x11, 0x02, 0x10, 0x14, 0xd0, 0xbd, 0x1a, 0x36, 0x12, 0xbb, 0x9c, 0x28,
+  0x11, 0x10, 0x41, 0x91, 0xed, 0x8a, 0x51, 0x23, 0xb8, 0xac, 0x19, 0x21, 0x00, 0x21, 0x13, 0xfb,
+  0x9e, 0x28, 0x25, 0x81, 0xbb, 0x8b, 0x21, 0x11, 0x10, 0x24, 0xc0, 0xbf, 0x09, 0x44, 0x03, 0xc9,
+  0x9b, 0x10, 0x11, 0x00, 0x32, 0x82, 0xee, 0x8b, 0x41, 0x24, 0xa0, 0xac, 0x09, 0x21, 0x00, 0x21,
+  0x13, 0xfa, 0xad, 0x28, 0x35, 0x82, 0xcb, 0x8b, 0x20, 0x11, 0x10, 0x32, 0xc1, 0xcf, 0x89, 0x53,
+  0x13, 0xb9, 0xac, 0x18, 0x12, 0x00, 0x31, 0x83, 0xed, 0x9c, 0x31, 0x35, 0xa0, 0xcb, 0x09, 0x11,
+  0x01, 0x10, 0x23, 0xf8, 0xbc, 0x29, 0x45, 0x82, 0xba, 0xab, 0x21, 0x11, 0x10, 0x43, 0xa1, 0xdf,
+  0x8a, 0x43, 0x14, 0xb8, 0xbb, 0x18, 0x12, 0x01, 0x31, 0x13, 0xfd, 0xab, 0x40, 0x25, 0x91, 0xcb,
+  0x89, 0x11, 0x01, 0x10, 0x23, 0xd8, 0xbe, 0x19, 0x54, 0x02, 0xba, 0xab, 0x20, 0x12, 0x10, 0x32,
+  0xa3, 0xef, 0x8b, 0x52, 0x23, 0xb8, 0xac, 0x19, 0x11, 0x01, 0x21, 0x13, 0xfb, 0xae, 0x20, 0x25,
+  0x81, 0xbb, 0x8b, 0x21, 0x02, 0x10, 0x24, 0xc0, 0xbf, 0x1a, 0x44, 0x13, 0xca, 0x9b, 0x28, 0x11,
+  0x00, 0x32, 0x93, 0xee, 0x9b, 0x42, 0x25, 0x98, 0xac, 0x09, 0x12, 0x00, 0x20, 0x22, 0xea, 0xad,
+  0x39, 0x35, 0x82, 0xcb, 0x8b, 0x20, 0x11, 0x10, 0x42, 0xb0, 0xcf, 0x0a, 0x53, 0x13, 0xb9, 0xac,
+  0x18, 0x12, 0x00, 0x22, 0x03, 0xde, 0x9c, 0x31, 0x26, 0xa0, 0xba, 0x0a, 0x21, 0x01, 0x20, 0x33,
+  0xf9, 0xbd, 0x29, 0x45, 0x01, 0xba, 0x9b, 0x20, 0x11, 0x10, 0x42, 0xa1, 0xcf, 0x8a, 0x62, 0x13,
+  0xa9, 0xac, 0x18, 0x11, 0x00, 0x31, 0x02, 0xfb, 0xad, 0x30, 0x35, 0xa1, 0xcb, 0x89, 0x21, 0x10,
+  0x10, 0x23, 0xd8, 0xaf, 0x1a, 0x35, 0x02, 0xba, 0x9c, 0x28, 0x11, 0x10, 0x31, 0x92, 0xdf, 0x9a,
+  0x52, 0x23, 0xb0, 0xad, 0x08, 0x11, 0x01, 0x20, 0x13, 0xfb, 0xbc, 0x30, 0x36, 0x91, 0xcb, 0x0a,
+  0x20, 0x01, 0x10, 0x32, 0xd0, 0xcd, 0x0a, 0x54, 0x02, 0xb9, 0xab, 0x10, 0x12, 0x00, 0x32, 0x83,
+  0xdf, 0x9b, 0x51, 0x24, 0x98, 0xac, 0x09, 0x12, 0x00, 0x11, 0x13, 0xea, 0xbd, 0x38, 0x35, 0x82,
+  0xcb, 0x8b, 0x20, 0x11, 0x10, 0x33, 0xc1, 0xcf, 0x0a, 0x53, 0x13, 0xb9, 0x9d, 0x18, 0x11, 0x00,
+  0x21, 0x83, 0xfc, 0xab, 0x51, 0x33, 0xa1, 0xad, 0x0a, 0x21, 0x00, 0x11, 0x23, 0xe9, 0xbd, 0x29,
+  0x45, 0x82, 0xba, 0x9b, 0x20, 0x11, 0x10, 0x33, 0xb2, 0xff, 0x8a, 0x52, 0x12, 0xa8, 0x9c, 0x19,
+  0x11, 0x00, 0x21, 0x03, 0xfb, 0x9d, 0x20, 0x35, 0x90, 0xbb, 0x0b, 0x21, 0x11, 0x20, 0x33, 0xf8,
+  0xcd, 0x19, 0x44, 0x02, 0xba, 0xab, 0x20, 0x02, 0x01, 0x42, 0x91, 0xde, 0x8b, 0x52, 0x14, 0xa8,
+  0xab, 0x09, 0x22, 0x00, 0x31, 0x13, 0xfb, 0x9f, 0x28, 0x34, 0x91, 0xcb, 0x8a, 0x21, 0x01, 0x10,
+  0x33, 0xc8, 0xcf, 0x09, 0x34, 0x13, 0xca, 0xab, 0x10, 0x12, 0x00, 0x42, 0x92, 0xed, 0x8b, 0x41,
+  0x25, 0xa8, 0xab, 0x1a, 0x21, 0x10, 0x20, 0x14, 0xf9, 0xac, 0x28, 0x35, 0x82, 0xcb, 0x8b, 0x20,
+  0x11, 0x10, 0x42, 0xb0, 0xcf, 0x0a, 0x63, 0x12, 0xb9, 0xab, 0x18, 0x12, 0x01, 0x31, 0x03, 0xee,
+  0x9b, 0x50, 0x24, 0x90, 0xac, 0x89, 0x21, 0x00, 0x11, 0x13, 0xe8, 0xbd, 0x29, 0x45, 0x82, 0xba,
+  0x9b, 0x20, 0x11, 0x10, 0x42, 0xa1, 0xcf, 0x8a, 0x62, 0x13, 0xa9, 0xac, 0x18, 0x11, 0x10, 0x30,
+  0x02, 0xfb, 0xad, 0x30, 0x35, 0x90, 0xbb, 0x0b, 0x21, 0x02, 0x20, 0x24, 0xd8, 0xbe, 0x1a, 0x45,
+  0x02, 0xc9, 0x9a, 0x28, 0x11, 0x18, 0x31, 0x92, 0xcf, 0x8b, 0x52, 0x14, 0xb0, 0xbb, 0x19, 0x12,
+  0x01, 0x31, 0x13, 0xfb, 0xaf, 0x20, 0x34, 0x81, 0xbc, 0x8a, 0x21, 0x01, 0x20, 0x32, 0xd0, 0xce,
+  0x09, 0x44, 0x02, 0xb9, 0xab, 0x28, 0x21, 0x00, 0x42, 0x92, 0xed, 0x9b, 0x51, 0x24, 0x98, 0xac,
+  0x09, 0x12, 0x00, 0x20, 0x13, 0xea, 0xad, 0x39, 0x35, 0x82, 0xcb, 0x8b, 0x20, 0x11, 0x10, 0x33,
+  0xc1, 0xcf, 0x0a, 0x53, 0x13, 0xb9, 0x9d, 0x18, 0x11, 0x00, 0x21, 0x02, 0xfc, 0x9b, 0x40, 0x25,
+  0x90, 0xcb, 0x09, 0x11, 0x01, 0x10, 0x13, 0xe8, 0xad, 0x29, 0x44, 0x02, 0xca, 0x8b, 0x10, 0x11,
+  0x10, 0x22, 0xb2, 0xdf, 0x8a, 0x62, 0x12, 0xa8, 0x9c, 0x19, 0x11, 0x00, 0x21, 0x03, 0xfb, 0x9d,
+  0x20, 0x25, 0x91, 0xbb, 0x8a, 0x21, 0x11, 0x20, 0x33, 0xf8, 0xbd, 0x1a, 0x45, 0x83, 0xc9, 0x9a,
+  0x28, 0x11, 0x00, 0x22, 0x92, 0xcf, 0x9b, 0x62, 0x23, 0xa8, 0xbc, 0x08, 0x12, 0x00, 0x21, 0x04,
+  0xea, 0xad, 0x20, 0x35, 0x81, 0xcb, 0x8a, 0x11, 0x01, 0x20, 0x32, 0xc8, 0xbf, 0x0a, 0x45, 0x12,
+  0xba, 0x9c, 0x28, 0x11, 0x00, 0x31, 0x82, 0xde, 0x9b, 0x51, 0x24, 0xa0, 0xac, 0x09, 0x21, 0x00,
+  0x11, 0x13, 0xf9, 0xbc, 0x28, 0x36, 0x81, 0xca, 0x8a, 0x10, 0x02, 0x10, 0x22, 0xb1, 0xdf, 0x0a,
+  0x62, 0x12, 0xa9, 0x9c, 0x18, 0x11, 0x00, 0x30, 0x82, 0xec, 0x9c, 0x31, 0x35, 0xa0, 0xcb, 0x09,
+  0x11, 0x01, 0x20, 0x22, 0xf8, 0xbc, 0x29, 0x45, 0x82, 0xba, 0x8c, 0x10, 0x11, 0x00, 0x32, 0xa1,
+  0xdf, 0x8a, 0x43, 0x14, 0xb8, 0xbb, 0x18, 0x12, 0x01, 0x31, 0x04, 0xfb, 0xad, 0x30, 0x35, 0x90,
+  0xbb, 0x0b, 0x21, 0x11, 0x20, 0x24, 0xd8, 0xbe, 0x1a, 0x45, 0x02, 0xba, 0xab, 0x20, 0x12, 0x10,
+  0x42, 0x91, 0xde, 0x8b, 0x52, 0x14, 0xa8, 0xbb, 0x19, 0x12, 0x01, 0x31, 0x13, 0xfb, 0xaf, 0x20,
+  0x34, 0x81, 0xbc, 0x99, 0x21, 0x01, 0x10, 0x33, 0xd0, 0xce, 0x09, 0x34, 0x04, 0xb9, 0x9c, 0x10,
+  0x01, 0x01, 0x21, 0x82, 0xed, 0x9b, 0x42, 0x25, 0x98, 0xac, 0x09, 0x12, 0x00, 0x20, 0x22, 0xea,
+  0xad, 0x39, 0x35, 0x82, 0xdb, 0x8a, 0x11, 0x01, 0x10, 0x22, 0xb1, 0xdf, 0x0a, 0x53, 0x12, 0xb8,
+  0xac, 0x18, 0x12, 0x00, 0x21, 0x83, 0xfc, 0x9c, 0x31, 0x25, 0x90, 0xcb, 0x09, 0x11, 0x01, 0x10,
+  0x23, 0xe9, 0xbd, 0x29, 0x45, 0x82, 0xba, 0x9b, 0x20, 0x11, 0x10, 0x33, 0xb2, 0xff, 0x0a, 0x51,
+  0x12, 0xa8, 0x9c, 0x19, 0x11, 0x00, 0x21, 0x12, 0xec, 0xbb, 0x50, 0x34, 0x90, 0xcb, 0x0a, 0x11,
+  0x01, 0x11, 0x23, 0xd8, 0xaf, 0x1a, 0x35, 0x02, 0xba, 0x9c, 0x28, 0x11, 0x10, 0x41, 0x91, 0xed,
+  0x8a, 0x51, 0x23, 0xb8, 0xac, 0x19, 0x21, 0x00, 0x21, 0x13, 0xfb, 0x9e, 0x28, 0x25, 0x81, 0xbb,
+  0x8b, 0x21, 0x11, 0x10, 0x43, 0xc0, 0xbf, 0x09, 0x44, 0x03, 0xc9, 0x9b, 0x28, 0x11, 0x00, 0x32,
+  0x82, 0xee, 0x8b, 0x41, 0x24, 0xa0, 0xcb, 0x09, 0x21, 0x00, 0x21, 0x13, 0xf9, 0xad, 0x28, 0x44,
+  0x82, 0xcb, 0x8a, 0x20, 0x01, 0x10, 0x32, 0xc1, 0xce, 0x0a, 0x53, 0x23, 0xc9, 0xab, 0x18, 0x12,
+  0x00, 0x31, 0x03, 0xde, 0x9c, 0x40, 0x24, 0xa1, 0xcb, 0x09, 0x11, 0x01, 0x20, 0x22, 0xe9, 0xbd,
+  0x29, 0x45, 0x82, 0xba, 0x9b, 0x20, 0x11, 0x10, 0x43, 0xa1, 0xdf, 0x8a, 0x43, 0x14, 0xb8, 0xbb,
+  0x18, 0x12, 0x01, 0x31, 0x13, 0xfd, 0xab, 0x40, 0x25, 0x91, 0xcb, 0x0a, 0x11, 0x01, 0x20, 0x22,
+  0xd8, 0xbe, 0x19, 0x35, 0x03, 0xca, 0xab, 0x20, 0x11, 0x10, 0x42, 0xa2, 0xde, 0x8b, 0x52, 0x14,
+  0xb0, 0xbb, 0x08, 0x12, 0x01, 0x31, 0x13, 0xfb, 0xaf, 0x20, 0x34, 0x81, 0xbc, 0x99, 0x21, 0x01,
+  0x10, 0x33, 0xd0, 0xbe, 0x0a, 0x45, 0x12, 0xba, 0x9c, 0x28, 0x11, 0x00, 0x31, 0x82, 0xde, 0x9b,
+  0x51, 0x24, 0xa0, 0xac, 0x09, 0x12, 0x00, 0x11, 0x23, 0xfa, 0xbc, 0x28, 0x36, 0x81, 0xca, 0x9a,
+  0x11, 0x02, 0x10, 0x32, 0xb0, 0xef, 0x89, 0x43, 0x13, 0xb9, 0xac, 0x18, 0x12, 0x00, 0x31, 0x83,
+  0xed, 0x9c, 0x40, 0x24, 0x90, 0xcb, 0x09, 0x11, 0x01, 0x10, 0x23, 0xe9, 0xbd, 0x18, 0x45, 0x82,
+  0xba, 0x9b, 0x20, 0x02, 0x10, 0x33, 0xb2, 0xff, 0x0a, 0x32, 0x15, 0xb8, 0xab, 0x19, 0x12, 0x01,
+  0x31, 0x03, 0xfc, 0x9d, 0x30, 0x34, 0x91, 0xbc, 0x8a, 0x12, 0x01, 0x11, 0x33, 0xe8, 0xbe, 0x19,
+  0x35, 0x03, 0xca, 0xab, 0x20, 0x11, 0x10, 0x32, 0xa3, 0xef, 0x8a, 0x51, 0x23, 0xb8, 0xac, 0x19,
+  0x21, 0x00, 0x21, 0x03, 0xfa, 0x9e, 0x28, 0x34, 0x92, 0xcb, 0x8a, 0x20, 0x01, 0x11, 0x32, 0xc0,
+  0xcf, 0x1a, 0x63, 0x02, 0xb9, 0xab, 0x10, 0x12, 0x10, 0x31, 0x83, 0xdf, 0x9b, 0x51, 0x24, 0x98,
+  0xac, 0x09, 0x12, 0x00, 0x11, 0x13, 0xf9, 0xbc, 0x38, 0x35, 0x82, 0xcb, 0x8b, 0x20, 0x11, 0x10,
+  0x33, 0xc1, 0xcf, 0x8a, 0x44, 0x03, 0xc8, 0xaa, 0x18, 0x11, 0x10, 0x21, 0x03, 0xed, 0x9c, 0x31,
+  0x25, 0xa1, 0xcb, 0x09, 0x11, 0x01, 0x10, 0x23, 0xe9, 0xbd, 0x29, 0x45, 0x82, 0xba, 0x9b, 0x20,
+  0x11, 0x10, 0x33, 0xb2, 0xff, 0x8a, 0x52, 0x22, 0xa9, 0x9c, 0x19, 0x11, 0x00, 0x21, 0x03, 0xec,
+  0x9c, 0x30, 0x35, 0xa1, 0xcb, 0x0a, 0x11, 0x01, 0x11, 0x23, 0xd8, 0xbf, 0x19, 0x35, 0x03, 0xcb,
+  0xaa, 0x20, 0x11, 0x00, 0x42, 0x91, 0xce, 0x9b, 0x53, 0x24, 0xa8, 0xac, 0x19, 0x11, 0x00, 0x21,
+  0x13, 0xfb, 0xad, 0x20, 0x35, 0x81, 0xac, 0x8a, 0x20, 0x01, 0x10, 0x23, 0xc0, 0xcf, 0x09, 0x34,
+  0x13, 0xca, 0xab, 0x10, 0x12, 0x00, 0x42, 0x92, 0xed, 0x8b, 0x41, 0x25, 0xa8, 0xab, 0x1a, 0x21,
+  0x10, 0x20, 0x14, 0xf9, 0xac, 0x28, 0x35, 0x82, 0xcb, 0x8b, 0x20, 0x02, 0x10, 0x32, 0xb1, 0xff,
+  0x09, 0x32, 0x14, 0xb9, 0xbb, 0x18, 0x13, 0x00, 0x42, 0x02, 0xed, 0xab, 0x51, 0x24, 0xa0, 0xbb,
+  0x0a, 0x22, 0x01, 0x20, 0x24, 0xe9, 0xbd, 0x18, 0x45, 0x01, 0xba, 0x9b, 0x20, 0x02, 0x10, 0x33,
+  0xa1, 0xff, 0x89, 0x32, 0x15, 0xb8, 0xab, 0x19, 0x12, 0x01, 0x21, 0x13, 0xfc, 0xac, 0x30, 0x26,
+  0x91, 0xbb, 0x8a, 0x21, 0x01, 0x11, 0x24, 0xd8, 0xbe, 0x19, 0x35, 0x03, 0xca, 0xab, 0x20, 0x02,
+  0x10, 0x32, 0xa3, 0xef, 0x8a, 0x51, 0x23, 0xb8, 0xac, 0x19, 0x21, 0x00, 0x21, 0x22, 0xfb, 0x9e,
+  0x28, 0x25, 0x81, 0xbb, 0x8b, 0x21, 0x11, 0x10, 0x33, 0xd0, 0xbf, 0x1a, 0x44, 0x13, 0xca, 0x9b,
+  0x18, 0x12, 0x10, 0x31, 0x83, 0xdf, 0x9b, 0x42, 0x25, 0x98, 0xac, 0x09, 0x12, 0x00, 0x20, 0x13,
+  0xea, 0xbd, 0x38, 0x35, 0x82, 0xcb, 0x8b, 0x20, 0x02, 0x10, 0x33, 0xc1, 0xcf, 0x0a, 0x53, 0x13,
+  0xb9, 0x9d, 0x18, 0x11, 0x00, 0x21, 0x02, 0xfc, 0x9b, 0x40, 0x25, 0x90, 0xbb, 0x0a, 0x21, 0x01,
+  0x20, 0x33, 0xf9, 0xae, 0x29, 0x44, 0x82, 0xba, 0xab, 0x21, 0x11, 0x10, 0x33, 0xb2, 0xff, 0x8a,
+  0x52, 0x12, 0xa8, 0x9c, 0x19, 0x11, 0x00, 0x21, 0x03, 0xec, 0xbb, 0x50, 0x34, 0x90, 0xcb, 0x0a,
+  0x11, 0x01, 0x11, 0x23, 0xd8, 0xbf, 0x19, 0x35, 0x83, 0xc9, 0x9b, 0x28, 0x11, 0x10, 0x32, 0xa2,
+  0xdf, 0x8b, 0x52, 0x14, 0xa8, 0xbb, 0x08, 0x12, 0x01, 0x21, 0x14, 0xfb, 0xac, 0x38, 0x26, 0x81,
+  0xbb, 0x8b, 0x21, 0x02, 0x20, 0x33, 0xe0, 0xbe, 0x0a, 0x45, 0x12, 0xba, 0xab, 0x28, 0x12, 0x00,
+  0x42, 0x82, 0xde, 0x9b, 0x61, 0x23, 0xa0, 0xbc, 0x09, 0x12, 0x01, 0x20, 0x23, 0xfa, 0xad, 0x28,
+  0x35, 0x92, 0xda, 0x8a, 0x11, 0x01, 0x10, 0x31, 0xa0, 0xdf, 0x89, 0x53, 0x12, 0xb9, 0xab, 0x18,
+  0x12, 0x10, 0x41, 0x02, 0xed, 0x9b, 0x50, 0x24, 0xa0, 0xbb, 0x0a, 0x22, 0x01, 0x20, 0x14, 0xe8,
+  0xbd, 0x18, 0x45, 0x01, 0xba, 0x9b, 0x20, 0x02, 0x10, 0x33, 0xa1, 0xff, 0x89, 0x32, 0x24, 0xa9,
+  0xac, 0x19, 0x12, 0x00, 0x21, 0x03, 0xfb, 0x9e, 0x20, 0x25, 0x80, 0xcb, 0x89, 0x21, 0x00, 0x10,
+  0x23, 0xd8, 0xcd, 0x19, 0x44, 0x02, 0xba, 0xab, 0x20, 0x02, 0x01, 0x42, 0x92, 0xcf, 0x8b, 0x52,
+  0x14, 0xb0, 0xbb, 0x19, 0x12, 0x01, 0x31, 0x13, 0xfb, 0xaf, 0x20, 0x34, 0x81, 0xbc, 0x99, 0x21,
+  0x01, 0x10, 0x33, 0xd0, 0xbe, 0x1b, 0x45, 0x12, 0xc9, 0x9b, 0x10, 0x11, 0x00, 0x22, 0x93, 0xde,
+  0x9b, 0x51, 0x24, 0xa0, 0xac, 0x09, 0x21, 0x00, 0x11, 0x23, 0xfa, 0xbc, 0x28, 0x36, 0x92, 0xca,
+  0x9a, 0x11, 0x02, 0x10, 0x32, 0xb0, 0xef, 0x89, 0x43, 0x13, 0xb9, 0xac, 0x18, 0x12, 0x00, 0x31,
+  0x83, 0xfd, 0x9b, 0x41, 0x34, 0xa0, 0xac, 0x0a, 0x21, 0x00, 0x21, 0x32, 0xf9, 0xad, 0x29, 0x44,
+  0x02, 0xbb, 0x8c, 0x10, 0x11, 0x00, 0x32, 0xb2, 0xdf, 0x8a, 0x43, 0x14, 0xb8, 0xbb, 0x18, 0x12,
+  0x01, 0x31, 0x04, 0xfb, 0x9e, 0x20, 0x25, 0x80, 0xbb, 0x8a, 0x21, 0x01, 0x11, 0x33, 0xe8, 0xbe,
+  0x19, 0x54, 0x02, 0xba, 0x9b, 0x28, 0x12, 0x00, 0x42, 0x91, 0xde, 0x9a, 0x52, 0x14, 0xa8, 0xab,
+  0x09, 0x22, 0x00, 0x21, 0x14, 0xfb, 0xac, 0x20, 0x26, 0x81, 0xbb, 0x8b, 0x21, 0x02, 0x10, 0x24,
+  0xc0, 0xce, 0x09, 0x63, 0x02, 0xb9, 0x9b, 0x18, 0x12, 0x10, 0x41, 0x92, 0xdd, 0x8c, 0x41, 0x33,
+  0xb0, 0xbc, 0x1a, 0x21, 0x01, 0x21, 0x14, 0xea, 0xbd, 0x38, 0x35, 0x82, 0xcb, 0x8b, 0x20, 0x11,
+  0x10, 0x33, 0xc1, 0xcf, 0x8a, 0x44, 0x13, 0xc9, 0x9b, 0x18, 0x11, 0x10, 0x21, 0x03, 0xfd, 0xaa,
+  0x41, 0x24, 0x90, 0xac, 0x89, 0x21, 0x00, 0x11, 0x23, 0xe9, 0xbd, 0x29, 0x45, 0x82, 0xba, 0xab,
+  0x21, 0x11, 0x10, 0x43, 0xa1, 0xdf, 0x8a, 0x43, 0x14, 0xb8, 0xbb, 0x18, 0x12, 0x01, 0x31, 0x13,
+  0xfd, 0xab, 0x40, 0x25, 0x91, 0xcb, 0x89, 0x11, 0x01, 0x10, 0x23, 0xd8, 0xbe, 0x19, 0x35, 0x13,
+  0xcb, 0x9c, 0x10, 0x02, 0x10, 0x31, 0x91, 0xde, 0x8b, 0x52, 0x14, 0xa8, 0xbb, 0x08, 0x12, 0x01,
+  0x31, 0x13, 0xfb, 0xaf, 0x20, 0x34, 0x81, 0xbc, 0x99, 0x21, 0x01, 0x10, 0x33, 0xd0, 0xbe, 0x0a,
+  0x45, 0x12, 0xba, 0x9c, 0x28, 0x11, 0x00, 0x31, 0x82, 0xde, 0x9b, 0x51, 0x24, 0xa0, 0xac, 0x09,
+  0x12, 0x00, 0x11, 0x23, 0xfa, 0xbc, 0x28, 0x36, 0x81, 0xca, 0x9a, 0x11, 0x02, 0x10, 0x32, 0xb0,
+  0xef, 0x89, 0x43, 0x13, 0xb9, 0xac, 0x18, 0x12, 0x00, 0x31, 0x83, 0xed, 0x9c, 0x31, 0x35, 0xa0,
+  0xcb, 0x89, 0x12, 0x01, 0x20, 0x23, 0xf9, 0xad, 0x29, 0x44, 0x02, 0xbb, 0x8c, 0x10, 0x11, 0x00,
+  0x32, 0xb2, 0xdf, 0x8a, 0x53, 0x13, 0xb8, 0xac, 0x19, 0x12, 0x00, 0x31, 0x12, 0xfc, 0x9c, 0x30,
+  0x25, 0x91, 0xcb, 0x0a, 0x11, 0x01, 0x20, 0x32, 0xd8, 0xaf, 0x1a, 0x44, 0x02, 0xc9, 0x9a, 0x10,
+  0x11, 0x00, 0x22, 0x92, 0xcf, 0x9b, 0x53, 0x14, 0xb0, 0xbb, 0x19, 0x12, 0x01, 0x31, 0x04, 0xfa,
+  0xad, 0x20, 0x35, 0x91, 0xbb, 0x8b, 0x21, 0x02, 0x20, 0x43, 0xc0, 0xbf, 0x0a, 0x54, 0x12, 0xc9,
+  0x9a, 0x18, 0x11, 0x00, 0x22, 0x82, 0xde, 0x9b, 0x52, 0x33, 0xb0, 0xbc, 0x09, 0x21, 0x01, 0x21,
+  0x23, 0xfa, 0xae, 0x39, 0x44, 0x92, 0xca, 0x8a, 0x20, 0x01, 0x10, 0x32, 0xb0, 0xdf, 0x0a, 0x53,
+  0x03, 0xc8, 0xaa, 0x18, 0x11, 0x01, 0x21, 0x03, 0xed, 0x9c, 0x31, 0x25, 0xa1, 0xcb, 0x09, 0x11,
+  0x01, 0x10, 0x23, 0xe9, 0xbd, 0x29, 0x45, 0x82, 0xba, 0x9b, 0x20, 0x11, 0x10, 0x43, 0xa1, 0xdf,
+  0x0a, 0x42, 0x14, 0xb8, 0xbb, 0x18, 0x12, 0x01, 0x31, 0x13, 0xfd, 0xab, 0x40, 0x34, 0x91, 0xbc,
+  0x8a, 0x12, 0x02, 0x20, 0x23, 0xf0, 0xbd, 0x19, 0x45, 0x82, 0xb9, 0x9c, 0x10, 0x02, 0x00, 0x32,
+  0x91, 0xde, 0x8b, 0x52, 0x14, 0xa8, 0xbb, 0x08, 0x12, 0x01, 0x31, 0x13, 0xfb, 0x9f, 0x28, 0x34,
+  0x91, 0xcb, 0x0a, 0x20, 0x01, 0x10, 0x23, 0xc0, 0xcf, 0x09, 0x34, 0x13, 0xca, 0xab, 0x10, 0x12,
+  0x00, 0x42, 0x92, 0xed, 0x8b, 0x41, 0x15, 0x90, 0xac, 0x08, 0x11, 0x00, 0x20, 0x12, 0xe9, 0xad,
+  0x28, 0x35, 0x82, 0xdb, 0x8a, 0x11, 0x01, 0x10, 0x22, 0xb1, 0xdf, 0x89, 0x53, 0x12, 0xb9, 0xbb,
+  0x10, 0x12, 0x10, 0x41, 0x02, 0xed, 0xab, 0x51, 0x24, 0x90, 0xac, 0x89, 0x12, 0x00, 0x11, 0x13,
+  0xe8, 0xbd, 0x29, 0x45, 0x01, 0xba, 0x9b, 0x20, 0x02, 0x10, 0x33, 0xb2, 0xff, 0x89, 0x32, 0x15,
+  0xb8, 0xab, 0x19, 0x12, 0x01, 0x21, 0x04, 0xfb, 0xac, 0x30, 0x26, 0x91, 0xbb, 0x8a, 0x21, 0x01,
+  0x11, 0x24, 0xd8, 0xbe, 0x19, 0x35, 0x03, 0xca, 0xab, 0x20, 0x02, 0x10, 0x32, 0xa3, 0xef, 0x8a,
+  0x51, 0x23, 0xb8, 0xac, 0x19, 0x21, 0x00, 0x21, 0x13, 0xfb, 0x9e, 0x28, 0x34, 0x92, 0xcb, 0x8a,
+  0x20, 0x11, 0x10, 0x32, 0xc0, 0xcf, 0x09, 0x53, 0x03, 0xc9, 0xaa, 0x10, 0x11, 0x00, 0x32, 0x82,
+  0xcf, 0xab, 0x52, 0x24, 0xa0, 0xcb, 0x09, 0x12, 0x00, 0x21, 0x13, 0xfa, 0xbc, 0x28, 0x36, 0x82,
+  0xcb, 0x9a, 0x11, 0x11, 0x10, 0x32, 0xc1, 0xbf, 0x0b, 0x54, 0x03, 0xc8, 0xaa, 0x18, 0x11, 0x01,
+  0x21, 0x83, 0xfc, 0x9c, 0x31, 0x25, 0x90, 0xcb, 0x09, 0x11, 0x01, 0x10, 0x23, 0xe9, 0xbd, 0x29,
+  0x45, 0x82, 0xba, 0x9b, 0x20, 0x11, 0x10, 0x33, 0xb2, 0xff, 0x0a, 0x51, 0x12, 0xa8, 0x9c, 0x19,
+  0x11, 0x00, 0x21, 0x03, 0xec, 0xbb, 0x50, 0x34, 0x90, 0xcb, 0x0a, 0x11, 0x01, 0x11, 0x23, 0xd8,
+  0xbf, 0x19, 0x35, 0x83, 0xc9, 0x9b, 0x28, 0x11, 0x10, 0x32, 0xa2, 0xdf, 0x8b, 0x52, 0x14, 0xa8,
+  0xbb, 0x08, 0x12, 0x01, 0x21, 0x14, 0xfb, 0xac, 0x38, 0x26, 0x81, 0xbb, 0x8b, 0x21, 0x02, 0x20,
+  0x33, 0xd0, 0xcf, 0x09, 0x34, 0x13, 0xca, 0xab, 0x10, 0x12, 0x00, 0x32, 0x83, 0xdf, 0x9b, 0x51,
+  0x24, 0xa0, 0xac, 0x09, 0x21, 0x00, 0x20, 0x13, 0xf9, 0xbc, 0x28, 0x36, 0x81, 0xca, 0x8a, 0x10,
+  0x02, 0x10, 0x22, 0xb1, 0xdf, 0x0a, 0x53, 0x13, 0xc9, 0x9b, 0x18, 0x11, 0x00, 0x32, 0x02, 0xde,
+  0xab, 0x51, 0x24, 0x90, 0xac, 0x89, 0x21, 0x81, 0x11, 0x23, 0xf8, 0xbc, 0x29, 0x45, 0x82, 0xba,
+  0x8c, 0x10, 0x11, 0x00, 0x32, 0xa1, 0xdf, 0x8a, 0x43, 0x14, 0xb8, 0xbb, 0x18, 0x12, 0x01, 0x31,
+  0x04, 0xfb, 0xad, 0x30, 0x35, 0x90, 0xbb, 0x0b, 0x21, 0x11, 0x20, 0x24, 0xd8, 0xbe, 0x2a, 0x54,
+  0x02, 0xba, 0xab, 0x20, 0x12, 0x00, 0x33, 0xa3, 0xef, 0x8b, 0x52, 0x23, 0xb8, 0xac, 0x09, 0x22,
+  0x00, 0x21, 0x13, 0xfb, 0xae, 0x20, 0x25, 0x92, 0xbb, 0x8b, 0x21, 0x11, 0x10, 0x24, 0xc0, 0xbf,
+  0x1a, 0x44, 0x13, 0xca, 0x9b, 0x18, 0x12, 0x10, 0x31, 0x83, 0xdf, 0x9b, 0x42, 0x25, 0x98, 0xac,
+  0x88, 0x12, 0x00, 0x20, 0x22, 0xea, 0xad, 0x39,
+};
+static Clip const clip2 = {
+  .name = "chime",
+  .sampleRate = 10000,
+  .numSamples = 6000,
+  .data = clip2Data,
+};
+
+Clip const *const clips[] = {
+  &clip0,
+  &clip1,
+  &clip2,
+  NULL,
+};
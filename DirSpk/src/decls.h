@@ -8,6 +8,7 @@
 //
 #include <ctype.h>
 #include <limits.h>
+#include <math.h>
 #include <stdbool.h>
 #include <string.h>
 
@@ -16,6 +17,11 @@
 //
 #include <asf.h>
 
+//
+// CMSIS DSP library
+//
+#include <arm_math.h>
+
 //////////////////////////////////
 // Project specific declarations
 //////////////////////////////////
@@ -37,6 +43,12 @@
 // Ultrasonic PWM period in microseconds = 84000000 / 40000 cycles
 #define US_PERIOD 2100
 
+// CPU, and DWT cycle counter, cycles per microsecond
+#define CYCLES_PER_US 84
+
+// Audio samples per second. One sample is output each PWM period.
+#define AUDIO_SAMPLE_RATE 40000
+
 // The various modes that the audio can be in
 typedef enum {
 	// No Audio - turn off PWM
@@ -45,49 +57,677 @@ typedef enum {
 	// Via ADC channels
 	AM_ADC = 1,
 	
-	// Given Hz to output
-	AM_HZ = 2	
+	// Given Hz to output, or a tune, via the synth voices
+	AM_HZ = 2,
+	
+	// A compressed clip from flash
+	AM_CLIP = 3,
+	
+	// A test signal from the signal generator
+	AM_SIGGEN = 4
 } AudioMode;
 
 // Set the audio mode
 void audioModeSet(AudioMode m);
 
-// The volume of the generated tone - 0 to 255
-// Written only from UI thread, so mutex not needed
-extern volatile uint8_t audioVolume;
-
-// Set the frequency of the generated tone. 0 means off.
+// Set the frequency of the generated tone, in Hz with 16 bits of fraction.
+// 0 means off.
 void audioFrequencySet(uint32_t hz);
 
+//
+// Audio processing chain
+//
+
+// Kinds of stage. A chain starts with a source and ends with a sink.
+typedef enum {
+	STAGE_SOURCE = 0, // Produces samples, ignoring its input
+	STAGE_FILTER,
+	STAGE_GAIN,
+	STAGE_MODULATOR, // Converts a sample to a carrier duty
+	STAGE_SINK, // Writes to hardware
+} AudioStageKind;
+
+// One step in processing a sample, run by the audio interrupt
+typedef struct {
+	char const *name;
+	AudioStageKind kind;
+	
+	// Process one sample
+	int32_t (*process)(int32_t sample);
+	
+	// Estimated worst case cost in cycles, checked when building a chain
+	uint32_t cycles;
+} AudioStage;
+
+// Maximum stages in a chain
+#define CHAIN_MAX_STAGES 8
+
+// Cycles per sample a chain may use - half the PWM period, leaving the rest
+// for tasks and other interrupts
+#define CHAIN_CYCLE_BUDGET (US_PERIOD / 2)
+
+// A chain of stages, built when the audio mode changes
+typedef struct {
+	// Different for every chain built
+	uint32_t id;
+	
+	AudioStage const *stages[CHAIN_MAX_STAGES];
+	uint8_t numStages;
+	
+	// Sum of stage estimates
+	uint32_t cycles;
+} AudioChain;
+
+// Measured cost of a stage
+typedef struct {
+	uint64_t total;
+	uint32_t max;
+} StageCycles;
+
+// Build a chain from a NULL terminated list of stages. NULL builds an empty
+// chain. Returns false if the stages are not a valid chain or are estimated
+// to cost over CHAIN_CYCLE_BUDGET.
+extern bool chainBuild(AudioChain *c, AudioStage const *const *stages);
+
+// Run a chain for one sample. Called from the audio interrupt.
+extern void chainRun(AudioChain const *c);
+
+// Measured cycles for each stage of the running chain, and the number of
+// samples they were measured over. For debugging: values may be torn.
+extern StageCycles const *chainCycles(uint32_t *samples);
+
+//
+// Audio parameters
+//
+
+// Everything the audio interrupt needs to know. Published as a block, so
+// that changes to several fields take effect in the same period.
+typedef struct {
+	// Incremented by each publish
+	uint32_t sequence;
+	
+	AudioMode mode;
+	
+	// The volume of generated audio - 0 to 255
+	uint8_t volume;
+	
+	// The frequency of the generated tone in Hz with 16 bits of fraction, or
+	// zero for off. Used in AM_HZ mode.
+	uint32_t freq;
+	
+	// Whether PWM duty quantization error is noise shaped, and whether TPDF
+	// dither is added to the DACC output. Both default to on.
+	bool noiseShaping;
+	bool dither;
+	
+	// Silence gate: shut down the H-bridge when samples have stayed below
+	// gateThreshold for gateHoldSamples. The threshold is also kept in dB
+	// below full scale, as set, for display.
+	bool gateEnabled;
+	int32_t gateThreshold;
+	uint8_t gateThresholdDb;
+	uint32_t gateHoldSamples;
+	
+	// Envelope tracking: lower the carrier level, as far as envelopeFloor
+	// duty counts from zero, when the signal is quiet
+	bool envelopeTracking;
+	int32_t envelopeFloor;
+	
+	// Stages run for mode
+	AudioChain chain;
+} AudioParams;
+
+// Start editing audio params. Returns a copy of the published params to
+// change, then publish with audioParamsPublish. Enters a critical section,
+// which does not mask the audio interrupt; must not block in between.
+extern AudioParams *audioParamsEdit(void);
+
+// Publish the params being edited. The audio interrupt adopts them at the
+// start of its next period.
+extern void audioParamsPublish(void);
+
+// The most recently published params
+extern AudioParams const *audioParams(void);
+
+// Whether the audio interrupt runs, or is about to run, mode m's chain
+extern bool audioModeActive(AudioMode m);
+
+// Set mode, tone frequency (as for audioFrequencySet) and volume in one change
+extern void audioSet(AudioMode m, uint32_t hz, uint8_t volume);
+
+// Set the volume of generated audio - 0 to 255
+extern void audioVolumeSet(uint8_t volume);
+
+// Set PWM duty noise shaping and DACC dither
+extern void audioQuantizationSet(bool noiseShaping, bool dither);
+
+// Set up the silence gate. It closes after the signal has been more than
+// thresholdDb below full scale for holdMs.
+extern void audioGateSet(bool enabled, uint8_t thresholdDb, uint16_t holdMs);
+
+// Whether the silence gate is letting sound through
+extern bool audioGateIsOpen(void);
+
+// Set up envelope tracking of the carrier level. When enabled, the level
+// falls as low as floorPercent of full drive in quiet passages.
+extern void audioEnvelopeTrackingSet(bool enabled, uint8_t floorPercent);
+
+// Average carrier drive level since the last call, in tenths of a percent
+// of full drive, and the number of samples it was averaged over. Blocks for
+// a few ms.
+extern uint32_t audioDriveTake(uint32_t *samples);
+
+//
+// Synth voices - square waves shaped by ADSR envelopes
+//
+
+// Number of voices that may sound at once
+#define NUM_VOICES 4
+
+// The voice used for single tones
+#define TONE_VOICE 0
+
+// Stages of a voice's envelope
+typedef enum {
+	ENV_IDLE = 0, ENV_ATTACK, ENV_DECAY, ENV_SUSTAIN, ENV_RELEASE
+} EnvelopeStage;
+
+// Shape of the envelope applied to every note.
+typedef struct {
+	uint16_t attackMs; // Time from silence to full level
+	uint16_t decayMs; // Time from full level down to sustain
+	uint8_t sustain; // Level held while note is on - 0 to 255
+	uint16_t releaseMs; // Time from full level to silence once note is off
+} EnvelopeParams;
+
+// Set the envelope used by all voices
+extern void synthEnvelopeSet(EnvelopeParams const *params);
+
+// Get the envelope used by all voices
+extern void synthEnvelopeGet(EnvelopeParams *params);
+
+// Phase increment for a frequency in Hz with 16 bits of fraction
+extern uint32_t synthIncrement(uint32_t hz);
+
+// Start a note on voice v, (re)triggering its envelope from the current
+// level. increment is from synthIncrement or noteToIncrement.
+extern void synthNoteOn(int v, uint32_t increment);
+
+// Change the pitch of voice v without retriggering its envelope
+extern void synthPitchSet(int v, uint32_t increment);
+
+// Release the note on voice v
+extern void synthNoteOff(int v);
+
+// Release all voices
+extern void synthAllOff(void);
+
+// Advance all voices by one sample and return their sum, -32768 to 32767.
+// Called from the audio interrupt.
+extern int32_t synthNextSample(void);
+
+// Start the synth
+extern void startSynth(void);
+
 //
 // Notes
 //
 
-// From a numbered note, derive a frequency
+// Octaves in the note tables, 0 to 10
+#define NOTE_OCTAVES 11
+
+// Tunings available for notes. Must match make_notes.py.
+typedef enum {
+	TEMPERAMENT_EQUAL = 0,
+	TEMPERAMENT_JUST, // Five limit, on C
+	TEMPERAMENT_PYTHAGOREAN,
+	TEMPERAMENT_MEANTONE, // Quarter comma
+	TEMPERAMENT_WERCKMEISTER, // Werckmeister III
+	NUM_TEMPERAMENTS
+} Temperament;
+
+// Generated by make_notes.py: names of temperaments, and for each, the
+// frequency (Hz, 16 bits of fraction) and synth phase increment of every
+// note from C0 to B10. All have A4 = 440Hz.
+extern char const *const temperamentNames[NUM_TEMPERAMENTS];
+extern uint32_t const noteFrequencies[NUM_TEMPERAMENTS][NOTE_OCTAVES * 12];
+extern uint32_t const noteIncrements[NUM_TEMPERAMENTS][NOTE_OCTAVES * 12];
+
+// From a numbered note, derive a frequency in Hz with 16 bits of fraction
 extern uint32_t noteToFrequency(uint8_t note);
 
+// From a numbered note, derive a synth phase increment
+extern uint32_t noteToIncrement(uint8_t note);
+
+// Select the temperament used for all notes
+extern void noteTemperamentSet(Temperament t);
+
+// The temperament in use
+extern Temperament noteTemperamentGet(void);
+
+// Detune note n of the scale (0 = C to 11 = B) by -100 to 100 cents
+extern void noteDetuneSet(uint8_t n, int8_t cents);
+
+// Detune of note n of the scale, in cents
+extern int8_t noteDetuneGet(uint8_t n);
+
 // From a numbered note return a name. p must be at least 3 chars long
 extern void noteToName(uint8_t note, char *p);
 
+// Move a note by a number of semitones, staying within the note tables
+extern uint8_t noteTranspose(uint8_t note, int semitones);
+
 // Go up one note
 extern uint8_t noteIncrement(uint8_t note);
 
 // Go down one note
 extern uint8_t noteDecrement(uint8_t note);
 
-// A note of tune data
+// Tunes are compact byte streams, generated by make_tables.py and read in
+// place from flash by a TuneReader. Times are in TUNE_TIME_UNIT_MS units.
+// A tune has one stream for each voice, played together.
+#define TUNE_TIME_UNIT_MS 16
+#define TUNE_MAX_VOICES NUM_VOICES
+
+// Tune event bytes are dddd iiii. dddd indexes the tune's duration table,
+// or is TUNE_ESCAPE. iiii is TUNE_REST, or the interval from the previous
+// note plus TUNE_INTERVAL_ZERO.
+#define TUNE_ESCAPE 0xf
+#define TUNE_ESCAPE_END 0x0
+#define TUNE_ESCAPE_LONG 0x1
+#define TUNE_REST 0
+#define TUNE_INTERVAL_ZERO 8
+
+// Reads events from a tune
 typedef struct {
-	// The note, encoded in the above scheme
+	uint8_t const *next;
+	uint8_t const *durations;
+	uint8_t gap;
+	uint8_t previous;
+} TuneReader;
+
+// One event of a tune
+typedef struct {
+	// The note, or zero for a rest
 	uint8_t note;
 	
-	// When to end. Encoded as milliseconds / 16 relative to start of play
-	// 0xffff marks end of data
-	uint16_t endAt;
-} TuneData;
+	// How long the note sounds
+	uint16_t duration;
+	
+	// Silence after the note
+	uint8_t gap;
+} TuneEvent;
+
+// Whether len bytes at tune are a tune the reader can play safely
+extern bool tuneValidate(uint8_t const *tune, uint32_t len);
+
+// Number of voices in a tune
+extern int tuneVoices(uint8_t const *tune);
+
+// Start reading voice v of a tune
+extern void tuneReaderInit(TuneReader *r, uint8_t const *tune, int v);
+
+// Read the next event. Returns false at the end of the tune.
+extern bool tuneReaderNext(TuneReader *r, TuneEvent *e);
 
 // Two tunes available
-extern TuneData tuneData1[];
-extern TuneData tuneData2[];
+extern uint8_t const tuneData1[];
+extern uint8_t const tuneData2[];
+
+//
+// Compressed clips
+//
+
+// A clip of IMA-ADPCM compressed audio
+typedef struct {
+	// Short name for CLI, etc
+	char const *name;
+	
+	// Samples per second. The player interpolates up to AUDIO_SAMPLE_RATE.
+	uint16_t sampleRate;
+	
+	// Number of samples (4 bit codes) in data
+	uint32_t numSamples;
+	
+	// Two codes per byte, first code in the low nibble
+	uint8_t const *data;
+} Clip;
+
+// All clips, generated by make_clips.py. NULL terminated.
+extern Clip const *const clips[];
+
+// Start playing a clip in AM_CLIP mode. If loop is set, plays until stopped.
+extern void clipStart(Clip const *clip, bool loop);
+
+// Stop playing
+extern void clipStop(void);
+
+// Whether a clip is playing. Only in AM_CLIP mode.
+extern bool clipIsPlaying(void);
+
+// Produce the next sample of the playing clip, or 0 if none.
+// Called from the audio interrupt.
+extern int32_t clipNextSample(void);
+
+//
+// Test signal generator
+//
+
+// Maximum number of tones in a multi-tone signal
+#define SIGGEN_MAX_TONES 4
+
+// Sweep frequency is updated once per this many samples
+#define SIGGEN_SWEEP_BLOCK 64
+
+// Number of rows summed to make pink noise
+#define SIGGEN_PINK_ROWS 8
+
+// Kinds of test signal
+typedef enum {
+	SIG_SWEEP = 0, // Repeating logarithmic sine sweep
+	SIG_MLS, // Maximum length sequence
+	SIG_PINK, // Pink noise
+	SIG_TONES, // Sum of up to SIGGEN_MAX_TONES sine waves
+} SignalType;
+
+// Describes a test signal. The same params always give the same signal.
+typedef struct {
+	SignalType type;
+	
+	// Seed for noise and for the start phases of tones. 
+	uint32_t seed;
+	
+	// SIG_SWEEP: start and end Hz. SIG_TONES: Hz of each tone, 0 if unused.
+	uint32_t freq[SIGGEN_MAX_TONES];
+	
+	// SIG_SWEEP: length of one sweep, in samples
+	uint32_t sweepSamples;
+	
+	// SIG_MLS: order of sequence, 4 to 16. Period is 2^order - 1 samples.
+	uint8_t mlsOrder;
+} SignalParams;
+
+// State of one signal generator
+typedef struct {
+	SignalParams params;
+	
+	// Samples produced
+	uint32_t count;
+	
+	// Noise source - LFSR for SIG_MLS, xorshift otherwise
+	uint32_t random;
+	
+	// Phase and per-sample increment of each sine. Increments have 32
+	// extra bits of fraction.
+	uint32_t phase[SIGGEN_MAX_TONES];
+	uint64_t increment[SIGGEN_MAX_TONES];
+	uint8_t numTones;
+	
+	// SIG_SWEEP: increment multiplier per SIGGEN_SWEEP_BLOCK, Q30
+	uint32_t sweepMultiplier;
+	
+	// SIG_PINK: rows and their sum
+	int32_t pinkRows[SIGGEN_PINK_ROWS];
+	int32_t pinkSum;
+} SignalGenerator;
+
+// Set up a generator to produce the signal described by params
+extern void siggenInit(SignalGenerator *g, SignalParams const *params);
+
+// Whether a sweep from f0 to f1 Hz over samples samples can be generated.
+// It must last at least one block, and rise by less than 4 times per block.
+extern bool siggenSweepValid(uint32_t f0, uint32_t f1, uint32_t samples);
+
+// Produce the next sample from a generator, -32768 to 32767
+extern int32_t siggenSample(SignalGenerator *g);
+
+// Start the audio interrupt's generator, for AM_SIGGEN mode
+extern void siggenStart(SignalParams const *params);
+
+// Stop the audio interrupt's generator
+extern void siggenStop(void);
+
+// Produce the next sample for the audio interrupt, or 0 if stopped.
+// Called from the audio interrupt.
+extern int32_t siggenNextSample(void);
+
+// Position in the signal of the sample last produced for the audio interrupt
+extern uint32_t siggenPosition(void);
+
+//
+// ADC capture and loopback measurement
+//
+
+// Start capturing periods consecutive runs of len samples from ADC channel
+// chan, summed into buf. Returns false if a capture is already running.
+extern bool captureStart(int32_t *buf, uint32_t len, uint32_t periods, uint32_t chan);
+
+// Whether the last capture has finished
+extern bool captureIsDone(void);
+
+// siggenPosition() when the last capture started
+extern uint32_t captureStartPosition(void);
+
+// Capture a sample, if capturing. Called from the audio interrupt.
+extern void captureSample(void);
+
+// Length of the measurement sweep and transform
+#define MEASURE_LEN 1024
+
+// Magnitude of bins that were not measured
+#define MEASURE_NO_DATA (-999.0f)
+
+// Measure the loop from audio output back to ADC channel chan with a sweep
+// from f0 to f1 Hz averaged over periods repetitions. Blocks the caller and
+// leaves audio mode AM_OFF. Returns false if no capture was made.
+extern bool measureRun(uint32_t f0, uint32_t f1, uint32_t periods, uint32_t chan);
+
+// Results of the last measureRun: MEASURE_LEN / 2 magnitudes in dB, each
+// bin AUDIO_SAMPLE_RATE / MEASURE_LEN Hz wide, and MEASURE_LEN impulse
+// response samples.
+extern float32_t const *measureMagnitudeDb(void);
+extern float32_t const *measureImpulse(void);
+
+//
+// Spectrum analyser
+//
+
+// Number of log spaced bands
+#define SPECTRUM_BANDS 16
+
+// Bands are clamped to this many dB below full scale
+#define SPECTRUM_FLOOR_DB 90
+
+// ADC channel analysed
+#define SPECTRUM_CHANNEL 0
+
+// Copy the latest bands, in dB relative to full scale, into levels.
+// Returns the number of blocks analysed so far.
+extern uint32_t spectrumGet(int8_t levels[SPECTRUM_BANDS]);
+
+// Centre frequency of band b in Hz
+extern uint32_t spectrumBandHz(int b);
+
+// Cycles taken to analyse the last block
+extern uint32_t spectrumCycles(void);
+
+// Start the spectrum analyser task
+extern void startSpectrum(void);
+
+//
+// Tune player
+//
+
+// The first voice used for tunes. Each voice of a tune plays on its own
+// synth voice from here up.
+#define PLAYER_VOICE 0
+
+// Start playing a tune, replacing any tune already playing
+extern void playerStart(uint8_t const *tune);
+
+// Stop playing
+extern void playerStop(void);
+
+// Whether a tune is playing
+extern bool playerIsPlaying(void);
+
+// Advance the player by one millisecond. Called from the tick hook.
+extern void playerTick(void);
+
+// Tempo has 8 bits of fraction. Unity plays tunes as written.
+#define PLAYER_TEMPO_UNITY 256
+#define PLAYER_TEMPO_MIN (PLAYER_TEMPO_UNITY / 4)
+#define PLAYER_TEMPO_MAX (PLAYER_TEMPO_UNITY * 4)
+
+// Largest transpose, in semitones, either way
+#define PLAYER_TRANSPOSE_MAX 24
+
+// Set the tempo. Takes effect immediately, even part way through a note.
+extern void playerTempoSet(uint16_t tempo);
+extern uint16_t playerTempoGet(void);
+
+// Set the transpose in semitones. The sounding note is retuned at once.
+extern void playerTransposeSet(int8_t semitones);
+extern int8_t playerTransposeGet(void);
+
+//
+// Flash store
+//
+
+// Size of a flash page, the unit of writing
+#define FLASH_PAGE_SIZE IFLASH1_PAGE_SIZE
+
+// Data written at run time lives at the top of flash bank 1. The program
+// must fit in bank 0.
+#define FLASH_STORE_SIZE 0x10000
+#define FLASH_STORE_START (IFLASH1_ADDR + IFLASH1_SIZE - FLASH_STORE_SIZE)
+
+// The last page of the store holds settings (encoder detent types). The
+// library has the rest.
+#define FLASH_SETTINGS_OFFSET (FLASH_STORE_SIZE - FLASH_PAGE_SIZE)
+
+// Set up the flash store. Call before the scheduler starts.
+extern void flashStoreInit(void);
+
+// Hold the store while reading it or starting playback from it, so no other
+// task writes it meanwhile. Lock returns false if not held within wait
+// ticks. Holders may write.
+extern bool flashStoreLock(portTickType wait);
+extern void flashStoreUnlock(void);
+
+// Address of a byte of the store
+extern uint8_t const *flashStoreAddress(uint32_t offset);
+
+// Erase and write one page of the store. Returns false on failure.
+extern bool flashStoreWrite(uint32_t offset, void const *data);
+
+//
+// Tune slots - tunes loaded into RAM at run time
+//
+
+#define STORE_RAM_SLOTS 2
+
+// Largest tune a slot holds
+#define STORE_TUNE_MAX 2048
+
+// Empty a slot and start loading a tune into it
+extern void storeTuneBegin(int slot);
+
+// Add bytes to the tune being loaded. Returns false if it is too big.
+extern bool storeTuneAppend(uint8_t const *data, uint32_t len);
+
+// Finish loading. Returns false, leaving the slot empty, if the tune is not
+// valid.
+extern bool storeTuneEnd(void);
+
+// The tune in a slot, or NULL if the slot is empty. Sets *len if not NULL.
+extern uint8_t const *storeTuneGet(int slot, uint32_t *len);
+
+//
+// Library of tunes and clips in the flash store
+//
+
+// Slots in the library, and the longest name
+#define LIBRARY_SLOTS 32
+#define LIBRARY_NAME_MAX 16
+
+// What a slot holds
+typedef enum {
+	LIBRARY_TUNE = 1, LIBRARY_CLIP
+} LibraryKind;
+
+// Index entry for one slot. Each entry has its own flash page.
+typedef struct {
+	// LIBRARY_MAGIC if the slot is in use
+	uint32_t magic;
+	
+	// Kind of data, and CRC-16 of the data
+	uint8_t kind;
+	uint16_t crc;
+	
+	// Where the data is in the flash store, and how long
+	uint32_t offset;
+	uint32_t length;
+	
+	// NUL terminated
+	char name[LIBRARY_NAME_MAX];
+} LibraryEntry;
+
+// The entry for a slot, or NULL if it is empty
+extern LibraryEntry const *libraryEntry(int slot);
+
+// Data of an entry, in flash. A clip entry's data is a Clip.
+extern uint8_t const *libraryData(LibraryEntry const *e);
+
+// Start writing a slot, replacing anything in it. A tune is length bytes.
+// A clip is length bytes of IMA-ADPCM at sampleRate. Stops playback.
+// Returns false if there is no room.
+extern bool libraryBegin(int slot, LibraryKind kind, char const *name,
+	uint32_t length, uint16_t sampleRate);
+
+// Add bytes to the slot being written. Returns false if there are too many
+// or they could not be written.
+extern bool libraryAppend(uint8_t const *data, uint32_t len);
+
+// Finish writing. Returns false, leaving the slot empty, if the data is not
+// complete and valid.
+extern bool libraryEnd(void);
+
+// Empty a slot. Stops playback.
+extern bool libraryDelete(int slot);
+
+// Whether the data of an entry matches its CRC
+extern bool libraryVerify(LibraryEntry const *e);
+
+// Size of the largest free space in the library, in bytes
+extern uint32_t libraryFree(void);
+
+//
+// Binary upload over the CLI UART
+//
+
+// Frames are SYNC, sequence, type, length, payload, then the CRC-16 of
+// sequence to payload, low byte first. Each is answered with ACK or NAK,
+// or CAN if the upload is abandoned.
+#define UPLOAD_SYNC 0x55
+#define UPLOAD_DATA 'D'
+#define UPLOAD_END 'E'
+#define UPLOAD_ACK 0x06
+#define UPLOAD_NAK 0x15
+#define UPLOAD_CAN 0x18
+#define UPLOAD_FRAME_MAX 255
+
+// Outcome of an upload
+typedef enum {
+	UPLOAD_OK, UPLOAD_TIMEOUT, UPLOAD_REFUSED, UPLOAD_BAD_FRAMES
+} UploadResult;
+
+// Takes the payload of each new frame. Returns false to refuse it.
+typedef bool (*UploadSink)(uint8_t const *data, uint32_t len);
+
+// Receive an upload, passing the data to sink as it arrives. Blocks the
+// calling task.
+extern UploadResult uploadReceive(UploadSink sink);
 
 //
 // Encoders
@@ -98,6 +738,20 @@ extern TuneData tuneData2[];
 // Encoder pin mask - Pins 12-19 of PIOC
 #define ENCODER_PINS 0x000ff000
 
+// Build option: encoders read by a TC quadrature decoder instead of the
+// PIOC interrupt, one bit per encoder. Only encoders 0 and 1 can be.
+//   Bit 0: encoder 0 on PB25, PB27 = D2, D13 (TC0). Takes the LED pin, so
+//          there is no alive blink or error code.
+//   Bit 1: encoder 1 on PC25, PC26 = D5, D4 (TC2). D4 is shared with
+//          SPI0_CS1 on PA29, so the screen must move to another chip select.
+#ifndef ENCODER_QDEC
+#define ENCODER_QDEC 0
+#endif
+
+// Encoder pins handled by the PIOC interrupt
+#define ENCODER_GPIO_PINS (ENCODER_PINS \
+	& ~((ENCODER_QDEC & 1 ? 0x3 << 12 : 0) | (ENCODER_QDEC & 2 ? 0x3 << 14 : 0)))
+
 // Direction sensed by Encoder - none, clockwise, counter-clockwise
 typedef enum {
 	ENC_NONE = 0, ENC_CW = 1, ENC_CCW = 2
@@ -107,6 +761,20 @@ typedef enum {
 // this EncoderSignals type - in the two LSB.
 typedef uint8_t EncoderSignals;
 
+// Depth of each encoder's debug history. Build option: a power of two, at
+// most 256.
+#ifndef ENCODER_HISTORY
+#define ENCODER_HISTORY 16
+#endif
+#if ENCODER_HISTORY & (ENCODER_HISTORY - 1) || ENCODER_HISTORY > 256
+#error ENCODER_HISTORY must be a power of two, at most 256
+#endif
+
+// A debug history entry, packed as: us since the previous change in bits
+// 31-8 (saturating at about 16s), state in bits 7-4, direction in bits 3-2 and signals
+// in bits 1-0.
+typedef uint32_t EncoderHistoryEntry;
+
 // Everything for a single encoder 
 typedef struct {
 	// The state machine table to use - different encoders require
@@ -116,28 +784,81 @@ typedef struct {
 	// Current state number
 	uint8_t state;
 	
-	// Debugging info - 0 is most recent, 9 is least recent
+	// Debugging info - a ring with history[head] the most recent
 	// Only contains information if signals differ from previously received
-	portTickType lastChange;
-	uint8_t previousStates[10];
-	EncoderSignals previousSignals[10]; 
-	EncoderDirection previousDirections[10];
-	uint32_t timeSince[10];
+	// lastChange is a DWT cycle count
+	uint32_t lastChange;
+	EncoderSignals signals;
+	uint8_t head;
+	EncoderHistoryEntry history[ENCODER_HISTORY];
+	
+	// Speed, for acceleration: when the last detent moved, as a DWT cycle
+	// count, and which way, and the average us per detent
+	uint32_t lastMove;
+	int8_t lastSign;
+	uint32_t interval;
+	
+	// Detent type detection: whether it is running, and the rests seen at
+	// 00 and at 11
+	bool detecting;
+	uint8_t restsLow;
+	uint8_t restsHigh;
 } EncoderState;
 
+// Detent type detection. An encoder rests when its signals are unchanged
+// this long. Its type is chosen after this many rests at 00 or 11.
+#define ENCODER_REST_MS 50
+#define ENCODER_DETECT_RESTS 8
+
+// Encoder acceleration curve. Above threshold detents per second, each
+// detent counts as 1 + (speed - threshold) * gain / 16 steps, up to
+// maxSteps. Gain 0 turns acceleration off.
+typedef struct {
+	uint16_t threshold;
+	uint16_t gain;
+	uint16_t maxSteps;
+} EncoderAccel;
+
+// A gap between detents longer than this restarts the speed average
+#define ENCODER_IDLE_MS 250
+
 // For debugging, print the encoder state
 extern void encoderStateSprint(char *buf, size_t buflen, EncoderState *encoder);
 
+// A raw snapshot of the PIOC pins, taken in the PIOC interrupt: the DWT
+// cycle count on entry and PIO_PDSR. Encoder n is on bits 12 + 2n and
+// 13 + 2n.
+typedef struct {
+	uint32_t cycles;
+	uint32_t pins;
+} EncoderEdge;
+
+// Snapshots kept while capturing, 8 bytes each. Build option: a power of
+// two.
+#ifndef ENCODER_CAPTURE
+#define ENCODER_CAPTURE 1024
+#endif
+#if ENCODER_CAPTURE & (ENCODER_CAPTURE - 1)
+#error ENCODER_CAPTURE must be a power of two
+#endif
+
+// Capture pin snapshots from the PIOC interrupt into a ring, for debugging.
+// Stop returns the number taken and the cycle count at the start; the ring
+// keeps the last ENCODER_CAPTURE, numbered from 0 at the start.
+extern void encoderCaptureStart(void);
+extern uint32_t encoderCaptureStop(uint32_t *start);
+extern EncoderEdge const *encoderCaptured(uint32_t i);
+
 // Information about a sensed direction for a particular encoder.
 // This struct will be sent through queues to tasks.
 typedef struct {
 	// Which encoder this is
 	int num;
 	
-	// A timestamp
-	portTickType when;
+	// When this happened, as a DWT cycle count. Wraps every 51 seconds.
+	uint32_t when;
 	
-	// When this happened
+	// Which way it moved
 	EncoderDirection dir;
 } EncoderMove;
 
@@ -147,14 +868,47 @@ extern void encoderPIOCHandler(uint32_t, uint32_t);
 // Start the encoder subsystem
 extern void startEncoders(void);
 
+// Start measuring PIOC handler cycles again
+extern void encoderCyclesReset(void);
+
+// Measured PIOC handler cycles, and the number of interrupts they were
+// measured over. For debugging: values may be torn.
+extern StageCycles const *encoderCycles(uint32_t *calls);
+
+// Turn quadrature decoder counts into moves.
+// Executes from within the tick interrupt
+extern void encoderTick(void);
+
 // State of the encoders. Owner: Encoder interrupt.
 // Exposed for debug through CLI.
 extern EncoderState encoderStates[NUM_ENCODERS];
 
 // For debugging. Holds EncoderMove objects.
-// All moves go in here, although queue may overflow.
+// Moves go in here while the CLI listens, although queue may overflow.
 extern xQueueHandle encoderDebugQueue;
 
+// Start or stop sending moves to encoderDebugQueue
+extern void encoderDebugListen(bool listen);
+
+// Take the net detents each encoder has moved since the last call,
+// clockwise positive, and the same with acceleration applied. Returns a
+// mask of the encoders with moves waiting.
+extern uint32_t encoderTake(int32_t d[NUM_ENCODERS], int32_t accelerated[NUM_ENCODERS]);
+
+// Set and get the acceleration curve
+extern void encoderAccelSet(EncoderAccel const *a);
+extern void encoderAccelGet(EncoderAccel *a);
+
+// Detent type of an encoder: 'A' or 'B'
+extern char encoderType(int num);
+
+// Detect the detent types of the encoders on GPIO pins again
+extern void encoderDetectAgain(void);
+
+// Save detent types to the flash store if detection has changed them.
+// Call from a task.
+extern void encoderSaveTypes(void);
+
 //
 // SPI control
 //
@@ -189,6 +943,9 @@ extern void errorBlink(short longBlinks, short shortBlinks);
 // Blink out a pattern for ever.
 extern void fatalBlink(short longBlinks, short shortBlinks);
 
+// CRC-16/CCITT of len bytes, continuing from crc. Start with 0xffff.
+extern uint16_t crc16(uint16_t crc, uint8_t const *data, uint32_t len);
+
 
 //
 // Initialization of MCU & peripherals
@@ -234,6 +991,9 @@ typedef struct {
 			uint8_t rightLevel;
 			uint8_t gain;
 			uint8_t fade;
+			uint8_t gated;
+			uint8_t gateThresholdDb;
+			uint16_t gateHoldMs;
 		};
 		// For generate mode
 		struct {
@@ -260,7 +1020,7 @@ void startScreen(void);
 
 // Type of queue item
 typedef enum {
-	UI_ENCODER,  // Event with encoder movement
+	UI_ENCODER,  // Encoders have moved - take the moves with encoderTake
 	UI_TICK, // Tick to update screen, tune, etc
 	UI_GOTO_GENERATE, // A touch has occurred asking for the GENERATE page
 	UI_GOTO_INPUT, // A touch has occurred asking for the INPUT page
@@ -273,9 +1033,6 @@ typedef enum {
 // The Queue item
 typedef struct {
 	UiType type;
-	union {
-		EncoderMove encMove;
-	};
 } UiEvent;
 
 // UiQueue for events from encoders, touch, etc. Contains UiEvents
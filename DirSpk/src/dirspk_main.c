@@ -7,7 +7,8 @@
 // The tick hook
 extern void vApplicationTickHook(void);
 void vApplicationTickHook(void) {
-	// do nothing
+	playerTick();
+	encoderTick();
 }
 
 // Liveness callback
@@ -26,11 +27,13 @@ int main(void) {
 	xTimerStart(timer, 0);
 	
 	// Start each task/subsystem
+	startSynth();
 	startEncoders();
 	startSpi();
 	startScreen();
 	startUi();
 	startCli();
+	startSpectrum();
 	
 	// Start Task scheduler
 	vTaskStartScheduler();
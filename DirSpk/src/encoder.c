@@ -3,8 +3,11 @@
 // Handles rotary encoders on PC12-PC19
 //
 // Runs an interrupt on change in encoder GPIO pin inputs. When the interrupt logic determines
-// that there has been a direction change, items are placed on RTOS queues for interpretation
-// by the UI and CLI tasks.
+// that there has been a direction change, it is added to a count of net moves for the encoder,
+// and the UI task is woken to take them.
+//
+// With ENCODER_QDEC, encoders 0 and 1 can instead be counted by the TC quadrature decoders,
+// which are polled from the tick hook.
 
 #include "decls.h"
 
@@ -13,7 +16,7 @@
 EncoderState encoderStates[NUM_ENCODERS];
 
 // For debugging. Holds EncoderMove objects.
-// All moves go in here, although queue may overflow.
+// Moves go in here while the CLI listens, although queue may overflow.
 xQueueHandle encoderDebugQueue;
 
 // An encoder is a device that indicates movement clockwise or counter-clockwise. By itself, it
@@ -95,9 +98,177 @@ static uint8_t stateTableB[][4] = {
 	{0x12, 0x70, 0x00, 0x60}, // State 7: 00->10->11->01
 };
 
-// Update a single encoder
+// Net detents moved by each encoder since the UI last took them, clockwise
+// positive, the same with acceleration, and a bit per encoder with moves
+// waiting. Updated with LDREX/STREX, so the interrupts can add while the UI
+// task takes.
+static volatile uint32_t deltas[NUM_ENCODERS];
+static volatile uint32_t accelDeltas[NUM_ENCODERS];
+static volatile uint32_t pending;
+
+// Acceleration curve. Written by tasks, read by the encoder interrupts.
+static volatile EncoderAccel accel = {
+	.threshold = 10,
+	.gain = 3,
+	.maxSteps = 16,
+};
+
+// Whether the CLI is reading encoderDebugQueue
+static volatile bool debugListening;
+
+// Atomically add v to *p. Returns the old value.
+static uint32_t atomicAdd(volatile uint32_t *p, uint32_t v) {
+	uint32_t old;
+	do {
+		old = __LDREXW(p);
+	} while (__STREXW(old + v, p));
+	return old;
+}
+
+// Atomically OR v into *p. Returns the old value.
+static uint32_t atomicOr(volatile uint32_t *p, uint32_t v) {
+	uint32_t old;
+	do {
+		old = __LDREXW(p);
+	} while (__STREXW(old | v, p));
+	return old;
+}
+
+// Atomically replace *p with v. Returns the old value.
+static uint32_t atomicSwap(volatile uint32_t *p, uint32_t v) {
+	uint32_t old;
+	do {
+		old = __LDREXW(p);
+	} while (__STREXW(v, p));
+	return old;
+}
+
+// Steps for delta detents of encoder num, accelerated by its speed.
+// Keeps an average of the time per detent: halfway to the latest each move,
+// so it follows a spin within a few detents. Restarts after a pause or a
+// change of direction. A gap just over a multiple of the 51 second cycle
+// counter wrap looks short, costing at most one accelerated detent.
+// Executes from within an interrupt
+static int32_t encoderAccelerate(int num, int32_t delta, uint32_t now) {
+	EncoderState *encoder = encoderStates + num;
+	int8_t sign = delta > 0 ? 1 : -1;
+	uint32_t n = delta * sign;
+	uint32_t dt = (now - encoder->lastMove) / CYCLES_PER_US;
+	if (dt > ENCODER_IDLE_MS * 1000 || sign != encoder->lastSign) {
+		encoder->interval = ENCODER_IDLE_MS * 1000;
+	} else {
+		encoder->interval = (encoder->interval + dt / n) >> 1;
+	}
+	encoder->lastMove = now;
+	encoder->lastSign = sign;
+	
+	uint32_t speed = 1000000 / max(encoder->interval, 1UL);
+	uint32_t steps = 1;
+	if (speed > accel.threshold) {
+		steps = min(1 + (speed - accel.threshold) * accel.gain / 16, max(accel.maxSteps, 1));
+	}
+	return delta * (int32_t) steps;
+}
+
+// Record delta detents for the UI, waking it if nothing was waiting, and
+// a move for debugging if the CLI is listening.
+// Executes from within an interrupt
+static void encoderMoved(int num, int32_t delta, uint32_t now, portBASE_TYPE *taskWoken) {
+	atomicAdd(deltas + num, delta);
+	atomicAdd(accelDeltas + num, encoderAccelerate(num, delta, now));
+	if (!atomicOr(&pending, 1 << num) && uiQueue) {
+		UiEvent event = {
+			.type = UI_ENCODER,
+		};
+		if (!xQueueSendToBackFromISR(uiQueue, &event, taskWoken)) {
+			uiQueueFullFlag = true;
+		}
+	}
+	
+	if (debugListening && encoderDebugQueue) {
+		EncoderMove move = {
+			.num = num,
+			.when = now,
+			.dir = delta > 0 ? ENC_CW : ENC_CCW,
+		};
+		xQueueSendToBackFromISR(encoderDebugQueue, &move, taskWoken);
+	}
+}
+
+// Take the net detents each encoder has moved since the last call,
+// clockwise positive, and the same with acceleration applied. Returns a
+// mask of the encoders with moves waiting.
+uint32_t encoderTake(int32_t d[NUM_ENCODERS], int32_t accelerated[NUM_ENCODERS]) {
+	uint32_t moved = atomicSwap(&pending, 0);
+	for (int i = 0; i < NUM_ENCODERS; i++) {
+		d[i] = (int32_t) atomicSwap(deltas + i, 0);
+		accelerated[i] = (int32_t) atomicSwap(accelDeltas + i, 0);
+	}
+	return moved;
+}
+
+// Set the acceleration curve
+void encoderAccelSet(EncoderAccel const *a) {
+	accel = *a;
+}
+
+// Get the acceleration curve
+void encoderAccelGet(EncoderAccel *a) {
+	*a = accel;
+}
+
+// Start or stop sending moves to encoderDebugQueue
+void encoderDebugListen(bool listen) {
+	debugListening = listen;
+}
+
+// Detent types as saved in the flash store's settings page: 'A', 'B', or
+// erased if not yet detected
+#define ENCODER_SETTINGS_MAGIC 0x53434e45 // "ENCS"
+typedef struct {
+	uint32_t magic;
+	uint8_t types[NUM_ENCODERS];
+} EncoderSettings;
+
+// Whether a detent type has changed since the types were saved
+static volatile bool typesChanged;
+
+// Count a rest of an encoder, and choose its state table once there are
+// enough. Type A encoders rest at both 00 and 11, alternately, and type B
+// only at 00. Anything else is unclear, so counting starts again.
+// Executes from within an interrupt
+static void encoderDetect(EncoderState *encoder, EncoderSignals rest) {
+	if (rest == 0) {
+		encoder->restsLow++;
+	} else if (rest == 3) {
+		encoder->restsHigh++;
+	} else {
+		return;
+	}
+	if (encoder->restsLow + encoder->restsHigh < ENCODER_DETECT_RESTS) {
+		return;
+	}
+	
+	uint8_t (*table)[4];
+	if (encoder->restsLow >= 2 && encoder->restsHigh >= 2) {
+		table = stateTableA;
+	} else if (!encoder->restsHigh) {
+		table = stateTableB;
+	} else {
+		encoder->restsLow = encoder->restsHigh = 0;
+		return;
+	}
+	if (table != encoder->table) {
+		encoder->table = table;
+		encoder->state = 0;
+	}
+	encoder->detecting = false;
+	typesChanged = true;
+}
+
+// Update a single encoder, with the DWT cycle count when its pins changed
 // Executes from within an interrupt
-static void encoderUpdate(int num, EncoderSignals signals) {
+static void encoderUpdate(int num, EncoderSignals signals, uint32_t now) {
 	EncoderState *encoder = encoderStates + num;
 	
 	// Look up instruction in this encoder's state table
@@ -108,18 +279,15 @@ static void encoderUpdate(int num, EncoderSignals signals) {
 	EncoderDirection dir = instruction & 3;
 	
 	// Update debug info if input signals differ from last signals
-	portTickType now = xTaskGetTickCount();
-	if (encoder->previousSignals[0] != signals) {
-		for (int i = 9; i > 0; i--) {
-			encoder->previousStates[i] = encoder->previousStates[i-1];
-			encoder->previousSignals[i] = encoder->previousSignals[i-1];
-			encoder->previousDirections[i] = encoder->previousDirections[i-1];
-			encoder->timeSince[i] = encoder->timeSince[i-1];
+	if (encoder->signals != signals) {
+		uint32_t since = min((now - encoder->lastChange) / CYCLES_PER_US, 0xffffffUL);
+		if (encoder->detecting && since >= ENCODER_REST_MS * 1000) {
+			encoderDetect(encoder, encoder->signals);
 		}
-		encoder->previousStates[0] = encoder->state;
-		encoder->previousSignals[0] = signals;
-		encoder->previousDirections[0] = dir;
-		encoder->timeSince[0] = now - encoder->lastChange;
+		encoder->head = (encoder->head + 1) & (ENCODER_HISTORY - 1);
+		encoder->history[encoder->head] =
+			since << 8 | encoder->state << 4 | dir << 2 | signals;
+		encoder->signals = signals;
 		encoder->lastChange = now;
 	}
 	
@@ -128,40 +296,126 @@ static void encoderUpdate(int num, EncoderSignals signals) {
 		return;
 	}
 	
-	// Record a UI Event
-	UiEvent event = {
-		.type = UI_ENCODER,
-		.encMove = {
-			.num = num,
-			.when = now,
-			.dir = dir,
-		}
-	};
-	
 	portBASE_TYPE taskWoken = false;
-	if (uiQueue) {
-		if (!xQueueSendToBackFromISR(uiQueue, &event, &taskWoken)) {
-			uiQueueFullFlag = true;
-		}
-	}
-	if (encoderDebugQueue) {
-		xQueueSendToBackFromISR(encoderDebugQueue, &event.encMove, &taskWoken);
-	}
+	encoderMoved(num, dir == ENC_CW ? 1 : -1, now, &taskWoken);
 	if (taskWoken) {
 		vPortYieldFromISR();
 	}
 }
 
+// Pins as of the last PIOC interrupt. Owner: Encoder interrupt.
+static uint32_t lastPins;
+
+// Cycles spent handling PIOC interrupts, and how many, for benchmarking.
+// Owner: Encoder interrupt, except while reset with it disabled.
+static StageCycles handlerCycles;
+static uint32_t handlerCalls;
+
+// Raw pin snapshots, for debugging. Owner: Encoder interrupt while
+// capturing, else the task that started the capture.
+static EncoderEdge edgeRing[ENCODER_CAPTURE];
+static uint32_t edgeCount;
+static uint32_t edgeStart;
+static volatile bool edgeCapturing;
+
 // Handle PIOC interrupt
 void encoderPIOCHandler(uint32_t unused_id, uint32_t unused_mask) {
-	// Get new values of pins from bits 19-12
-	uint32_t curr = PIOC->PIO_PDSR >> 12;
+	uint32_t start = DWT->CYCCNT;
 	
-	//encoderUpdate(0, curr&3);
-	for (int i = 0; i < NUM_ENCODERS; i++) {
-		encoderUpdate(i, curr & 3);
+	// Only update encoders whose pins changed. ASF has already read and
+	// cleared PIO_ISR, so compare with the pins last time instead.
+	uint32_t pins = PIOC->PIO_PDSR;
+	uint32_t changed = (pins ^ lastPins) & ENCODER_GPIO_PINS;
+	lastPins = pins;
+	if (edgeCapturing) {
+		edgeRing[edgeCount++ & (ENCODER_CAPTURE - 1)] = (EncoderEdge) {start, pins};
+	}
+	
+	// Get new values of pins from bits 19-12
+	uint32_t curr = pins >> 12;
+	changed >>= 12;
+	for (int i = 0; changed; i++) {
+		if (changed & 3) {
+			encoderUpdate(i, curr & 3, start);
+		}
 		curr >>= 2;
+		changed >>= 2;
 	}
+	
+	uint32_t cycles = DWT->CYCCNT - start;
+	handlerCycles.total += cycles;
+	handlerCycles.max = max(handlerCycles.max, cycles);
+	handlerCalls++;
+}
+
+// Start measuring PIOC handler cycles again
+void encoderCyclesReset(void) {
+	NVIC_DisableIRQ((IRQn_Type) ID_PIOC);
+	handlerCycles.total = 0;
+	handlerCycles.max = 0;
+	handlerCalls = 0;
+	NVIC_EnableIRQ((IRQn_Type) ID_PIOC);
+}
+
+// Measured PIOC handler cycles, and the number of interrupts they were
+// measured over. For debugging: values may be torn.
+StageCycles const *encoderCycles(uint32_t *calls) {
+	*calls = handlerCalls;
+	return &handlerCycles;
+}
+
+// Start capturing pin snapshots, discarding any captured before
+void encoderCaptureStart(void) {
+	edgeCount = 0;
+	edgeStart = DWT->CYCCNT;
+	edgeCapturing = true;
+}
+
+// Stop capturing. Returns the number of snapshots taken, of which the
+// ring keeps the last ENCODER_CAPTURE, and the cycle count at the start.
+uint32_t encoderCaptureStop(uint32_t *start) {
+	edgeCapturing = false;
+	*start = edgeStart;
+	return edgeCount;
+}
+
+// Snapshot i of those taken, if it is still in the ring
+EncoderEdge const *encoderCaptured(uint32_t i) {
+	return edgeRing + (i & (ENCODER_CAPTURE - 1));
+}
+
+#if ENCODER_QDEC
+// Quadrature decoders for encoders 0 and 1
+static Tc *const qdecTc[2] = {TC0, TC2};
+
+// Decoder count at the last move sent. Owner: tick hook.
+static int32_t qdecPosition[2];
+#endif
+
+// Turn quadrature decoder counts into moves. The decoders count every edge of
+// both signals, four per cycle: type A encoders move every two counts and
+// type B every four. Contact bounce counts back and forth, so it cancels out.
+// Executes from within the tick interrupt
+void encoderTick(void) {
+#if ENCODER_QDEC
+	uint32_t now = DWT->CYCCNT;
+	portBASE_TYPE taskWoken = false;
+	for (int i = 0; i < 2; i++) {
+		if (!(ENCODER_QDEC & (1 << i))) {
+			continue;
+		}
+		int32_t count = (int32_t) qdecTc[i]->TC_CHANNEL[0].TC_CV;
+		int32_t step = encoderStates[i].table == stateTableA ? 2 : 4;
+		int32_t moves = (count - qdecPosition[i]) / step;
+		if (moves) {
+			qdecPosition[i] += moves * step;
+			encoderMoved(i, moves, now, &taskWoken);
+		}
+	}
+	if (taskWoken) {
+		vPortYieldFromISR();
+	}
+#endif
 }
 
 // Start the encoder subsystem
@@ -174,22 +428,84 @@ void startEncoders(void) {
 	encoderStates[1].table = stateTableA;
 	encoderStates[2].table = stateTableB; // not connected
 	encoderStates[3].table = stateTableB; // not connected
+	
+	// Use saved detent types, or detect them. Encoders on a quadrature
+	// decoder cause no PIOC interrupts, so keep their default.
+	EncoderSettings const *saved =
+		(EncoderSettings const *) flashStoreAddress(FLASH_SETTINGS_OFFSET);
+	bool valid = saved->magic == ENCODER_SETTINGS_MAGIC;
+	for (int i = 0; i < NUM_ENCODERS; i++) {
+		EncoderState *encoder = encoderStates + i;
+		if (valid && saved->types[i] == 'A') {
+			encoder->table = stateTableA;
+		} else if (valid && saved->types[i] == 'B') {
+			encoder->table = stateTableB;
+		} else {
+			encoder->detecting = !(ENCODER_QDEC & (1 << i));
+		}
+	}
+}
+
+// Detent type of an encoder: 'A' or 'B'
+char encoderType(int num) {
+	return encoderStates[num].table == stateTableA ? 'A' : 'B';
+}
+
+// Detect the detent types of the encoders on GPIO pins again. Racing the
+// interrupt can at worst lose a rest.
+void encoderDetectAgain(void) {
+	for (int i = 0; i < NUM_ENCODERS; i++) {
+		EncoderState *encoder = encoderStates + i;
+		encoder->restsLow = encoder->restsHigh = 0;
+		encoder->detecting = !(ENCODER_QDEC & (1 << i));
+	}
+	typesChanged = true;
+}
+
+// Save detent types to the flash store if detection has changed them.
+// Encoders still detecting are saved as unknown. Bank 1 cannot be read
+// while it is written, so waits until nothing plays from it, and until the
+// CLI has finished with the library. Holding the store stops playback from
+// starting. Call from a task.
+void encoderSaveTypes(void) {
+	if (!typesChanged || !flashStoreLock(0)) {
+		return;
+	}
+	if (playerIsPlaying() || clipIsPlaying()) {
+		flashStoreUnlock();
+		return;
+	}
+	typesChanged = false;
+	
+	static uint32_t page[FLASH_PAGE_SIZE / 4];
+	memset(page, 0xff, sizeof(page));
+	EncoderSettings *settings = (EncoderSettings *) page;
+	settings->magic = ENCODER_SETTINGS_MAGIC;
+	for (int i = 0; i < NUM_ENCODERS; i++) {
+		if (!encoderStates[i].detecting) {
+			settings->types[i] = encoderType(i);
+		}
+	}
+	flashStoreWrite(FLASH_SETTINGS_OFFSET, page);
+	flashStoreUnlock();
 }
 
 
 static char const *SEP = ", ";
 
-// For debugging, print the encoder state
+// For debugging, print the encoder state, most recent change first, with
+// the us since the change before
 void encoderStateSprint(char *buf, size_t buflen, EncoderState *encoder) {
 	char *p = buf;
 	int remaining = buflen;
-	for (int i = 0; i < 10; i++) {
-		int r = snprintf(p, remaining, "%s[%1hhx %1hhd %1d %3lu]", 
+	for (int i = 0; i < ENCODER_HISTORY; i++) {
+		EncoderHistoryEntry e = encoder->history[(encoder->head - i) & (ENCODER_HISTORY - 1)];
+		int r = snprintf(p, remaining, "%s[%1lx %1lu %1lu %6lu]", 
 		    i > 0 ? SEP : "", 
-			encoder->previousStates[i],
-			encoder->previousSignals[i],
-			encoder->previousDirections[i],
-			encoder->timeSince[i]);
+			(e >> 4) & 0xf,
+			e & 3,
+			(e >> 2) & 3,
+			e >> 8);
 		if (r <= 0 || r > remaining) {
 			// Some kind of output or truncation
 			return ;
@@ -199,4 +515,4 @@ void encoderStateSprint(char *buf, size_t buflen, EncoderState *encoder) {
 		p += r;
 		remaining -= r;
 	}
-}
\ No newline at end of file
+}
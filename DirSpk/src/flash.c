@@ -0,0 +1,90 @@
+// flash.c
+//
+// Writable store in internal flash.
+//
+// The top FLASH_STORE_SIZE bytes of flash bank 1 are kept for data written
+// at run time. Pages are programmed through EFC1 with the erase and write
+// page command. The program runs from bank 0, so it keeps running while
+// bank 1 is busy, and interrupts need not be held off. The CLI and UI tasks
+// both write, under a mutex that readers of the store also hold.
+
+#include "decls.h"
+
+// Key that must accompany every EEFC command
+#define EEFC_KEY 0x5a
+
+// EEFC commands
+#define EEFC_CMD_EWP 0x03 // Erase and write page
+#define EEFC_CMD_CLB 0x09 // Clear lock bit
+
+// Pages from the start of bank 1 to the start of the store
+#define FLASH_STORE_FIRST_PAGE ((FLASH_STORE_START - IFLASH1_ADDR) / FLASH_PAGE_SIZE)
+
+// Held while a page is written, and by tasks reading or playing from the
+// store. Recursive, so holders can write.
+static xSemaphoreHandle flashMutex;
+
+// Set up the flash store. Call before the scheduler starts.
+void flashStoreInit(void) {
+	flashMutex = xSemaphoreCreateRecursiveMutex();
+	ASSERT_BLINK(flashMutex, 1, 13);
+}
+
+// Hold the store, waiting up to wait ticks. Returns false if another task
+// still holds it.
+bool flashStoreLock(portTickType wait) {
+	return xSemaphoreTakeRecursive(flashMutex, wait) == pdTRUE;
+}
+
+void flashStoreUnlock(void) {
+	xSemaphoreGiveRecursive(flashMutex);
+}
+
+// Run an EEFC command on bank 1, and wait for it to finish.
+// Returns the status flags.
+static uint32_t flashCommand(uint32_t cmd, uint32_t page) {
+	EFC1->EEFC_FCR = EEFC_FCR_FKEY(EEFC_KEY) | EEFC_FCR_FARG(page) | EEFC_FCR_FCMD(cmd);
+	uint32_t status;
+	do {
+		status = EFC1->EEFC_FSR;
+	} while (!(status & EEFC_FSR_FRDY));
+	return status;
+}
+
+// Address of a byte of the store
+uint8_t const *flashStoreAddress(uint32_t offset) {
+	return (uint8_t const *) (FLASH_STORE_START + offset);
+}
+
+// Erase and write one page of the store, FLASH_PAGE_SIZE bytes from data.
+// offset must be a multiple of FLASH_PAGE_SIZE. Call from a task.
+// Returns false if the page could not be written.
+bool flashStoreWrite(uint32_t offset, void const *data) {
+	if (offset % FLASH_PAGE_SIZE || offset >= FLASH_STORE_SIZE) {
+		return false;
+	}
+	uint32_t page = FLASH_STORE_FIRST_PAGE + offset / FLASH_PAGE_SIZE;
+	flashStoreLock(portMAX_DELAY);
+
+	// Fill the latch buffer by writing words anywhere in the page
+	uint32_t const *src = data;
+	volatile uint32_t *dest = (volatile uint32_t *) (FLASH_STORE_START + offset);
+	for (int i = 0; i < FLASH_PAGE_SIZE / 4; i++) {
+		dest[i] = src[i];
+	}
+
+	uint32_t status = flashCommand(EEFC_CMD_EWP, page);
+	if (status & EEFC_FSR_FLOCKE) {
+		// Region was locked. Unlock it and write again.
+		for (int i = 0; i < FLASH_PAGE_SIZE / 4; i++) {
+			dest[i] = src[i];
+		}
+		flashCommand(EEFC_CMD_CLB, page);
+		status = flashCommand(EEFC_CMD_EWP, page);
+	}
+	flashStoreUnlock();
+	if (status & (EEFC_FSR_FCMDE | EEFC_FSR_FLOCKE)) {
+		return false;
+	}
+	return memcmp((void const *) dest, data, FLASH_PAGE_SIZE) == 0;
+}
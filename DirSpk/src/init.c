@@ -35,14 +35,14 @@ static void initGpio(void) {
 	// PIOC - PC4 = D36 = SD H-bridge - pull high to turn on
 	ioport_set_pin_dir(PIO_PC4_IDX, IOPORT_DIR_OUTPUT);
 	
-	// PIOC - PC12-PC19 = D51-D44 for encoders
+	// PIOC - PC12-PC19 = D51-D44 for encoders, less any on quadrature decoders
 	// Uses pio_ API since an interrupt handler is needed
-	pio_set_input(PIOC, ENCODER_PINS, PIO_PULLUP);
+	pio_set_input(PIOC, ENCODER_GPIO_PINS, PIO_PULLUP);
 	//pio_set_debounce_filter(PIOC, ENCODER_PINS, 500); // De-bounce at 500Hz
-	pio_handler_set(PIOC, ID_PIOC, ENCODER_PINS, 0, encoderPIOCHandler);
+	pio_handler_set(PIOC, ID_PIOC, ENCODER_GPIO_PINS, 0, encoderPIOCHandler);
 	// Not quite the lowest priority
 	pio_handler_set_priority(PIOC, ID_PIOC, configLIBRARY_LOWEST_INTERRUPT_PRIORITY - 1);
-	pio_enable_interrupt(PIOC, ENCODER_PINS);
+	pio_enable_interrupt(PIOC, ENCODER_GPIO_PINS);
 	
 	// TODO: put current sense on NMI
 	// TODO: add display wait, int
@@ -82,7 +82,8 @@ static void initAdc(void) {
 freertos_uart_if freeRTOSUART;
 
 static void initUart(void) {
-#define rxBufSize 100
+	// Holds a whole upload frame
+#define rxBufSize 512
 	static uint8_t rxBuf[rxBufSize];
 	
 	// UART already initialized by board_init()
@@ -139,6 +140,36 @@ static void initTimers(void) {
 	*/
 }
 
+#if ENCODER_QDEC
+// Set up channel 0 of a TC block as a quadrature decoder, counting every edge
+// of both phases. Its inputs are TIOA and TIOB of the channel, peripheral B.
+static void initQdecBlock(Tc *tc, uint32_t id, ioport_pin_t pha, ioport_pin_t phb) {
+	ioport_set_pin_mode(pha, IOPORT_MODE_MUX_B | IOPORT_MODE_PULLUP);
+	ioport_disable_pin(pha);
+	ioport_set_pin_mode(phb, IOPORT_MODE_MUX_B | IOPORT_MODE_PULLUP);
+	ioport_disable_pin(phb);
+	
+	pmc_enable_periph_clk(id);
+	tc->TC_CHANNEL[0].TC_CMR = TC_CMR_TCCLKS_XC0;
+	// Filter pulses under 64 MCK cycles
+	tc->TC_BMR = TC_BMR_QDEN | TC_BMR_POSEN | TC_BMR_MAXFILT(63);
+	tc->TC_CHANNEL[0].TC_CCR = TC_CCR_CLKEN | TC_CCR_SWTRG;
+}
+
+// Quadrature decoders for the encoders selected by ENCODER_QDEC.
+// The counts are polled by encoderTick.
+static void initQdec(void) {
+	if (ENCODER_QDEC & 1) {
+		// PB25, PB27 = D2, D13 = TIOA0, TIOB0
+		initQdecBlock(TC0, ID_TC0, PIO_PB25_IDX, PIO_PB27_IDX);
+	}
+	if (ENCODER_QDEC & 2) {
+		// PC25, PC26 = D5, D4 = TIOA6, TIOB6
+		initQdecBlock(TC2, ID_TC6, PIO_PC25_IDX, PIO_PC26_IDX);
+	}
+}
+#endif
+
 // Init PWM
 static void initPwm(void) {
 	pmc_enable_periph_clk(ID_PWM);
@@ -219,6 +250,22 @@ static void initSpi0(void) {
 	SPI0->SPI_CSR[1] = (clk << 8) + (8 << 4) + 1;
 }
 
+// Start the DWT cycle counter, used for timing
+static void initCycleCounter(void) {
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+// Check the program fits in flash bank 0, leaving bank 1 for the flash
+// store. Bank 1 cannot be read while it is being written.
+static void initFlash(void) {
+	extern uint32_t _etext, _srelocate, _erelocate;
+	uint32_t end = (uint32_t) &_etext + ((uint32_t) &_erelocate - (uint32_t) &_srelocate);
+	ASSERT_BLINK(end <= IFLASH1_ADDR, 1, 12);
+	flashStoreInit();
+}
+
 void init(void) {
 	sysclk_init();
 	NVIC_SetPriorityGrouping(0);
@@ -228,7 +275,12 @@ void init(void) {
 	initAdc();
 	initUart();
 	initTimers();
+#if ENCODER_QDEC
+	initQdec();
+#endif
 	initPwm();
 	initDac();
 	initSpi0();
+	initCycleCounter();
+	initFlash();
 }
\ No newline at end of file
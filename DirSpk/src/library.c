@@ -0,0 +1,204 @@
+// library.c
+//
+// Indexed library of tunes and clips in the flash store.
+//
+// The store starts with an index of LIBRARY_SLOTS entries, one per flash
+// page, so finding a slot is a single address calculation and rewriting one
+// entry cannot disturb another. Data follows the index, page aligned, in
+// the first gap big enough before the settings page. Tunes and clips are
+// played straight from flash: a clip's data starts with a Clip pointing at
+// its own samples and name.
+//
+// Bank 1 cannot be read while it is written, so playback stops before the
+// library changes. Only the CLI task writes.
+
+#include "decls.h"
+
+// Marks an index entry in use
+#define LIBRARY_MAGIC 0x5942494c // "LIBY"
+
+// Data area follows the index
+#define LIBRARY_DATA_START (LIBRARY_SLOTS * FLASH_PAGE_SIZE)
+
+// Round up to whole pages
+#define PAGES(n) (((n) + FLASH_PAGE_SIZE - 1) / FLASH_PAGE_SIZE)
+
+// Page being written, and the entry for the slot being written
+static uint32_t page[FLASH_PAGE_SIZE / 4];
+static LibraryEntry writing;
+static int writingSlot;
+static uint32_t written;
+
+// The entry for a slot, or NULL if it is empty
+LibraryEntry const *libraryEntry(int slot) {
+	if (slot < 0 || slot >= LIBRARY_SLOTS) {
+		return NULL;
+	}
+	LibraryEntry const *e = (LibraryEntry const *) flashStoreAddress(slot * FLASH_PAGE_SIZE);
+	return e->magic == LIBRARY_MAGIC ? e : NULL;
+}
+
+// Data of an entry, in flash. A clip entry's data is a Clip.
+uint8_t const *libraryData(LibraryEntry const *e) {
+	return flashStoreAddress(e->offset);
+}
+
+// Stop anything that may be reading the library, and give the tick hook
+// and audio interrupt time to notice
+static void libraryStopPlayback(void) {
+	playerStop();
+	clipStop();
+	vTaskDelay(MS_TO_TICKS(2));
+}
+
+// Write len bytes of src as an index page, padded with erased bytes
+static bool libraryWriteIndex(int slot, void const *src, uint32_t len) {
+	memset(page, 0xff, sizeof(page));
+	memcpy(page, src, len);
+	return flashStoreWrite(slot * FLASH_PAGE_SIZE, page);
+}
+
+// Find the first gap in the data area of at least length bytes, ignoring
+// slot. Returns its offset in the store, or 0 if there is none.
+static uint32_t libraryAllocate(uint32_t length, int ignore) {
+	uint32_t start = LIBRARY_DATA_START;
+	for (;;) {
+		// Find the first entry that overlaps start onwards
+		uint32_t end = start + PAGES(length) * FLASH_PAGE_SIZE;
+		LibraryEntry const *clash = NULL;
+		for (int s = 0; s < LIBRARY_SLOTS; s++) {
+			LibraryEntry const *e = libraryEntry(s);
+			if (e && s != ignore && e->offset < end &&
+					e->offset + PAGES(e->length) * FLASH_PAGE_SIZE > start) {
+				clash = e;
+				break;
+			}
+		}
+		if (!clash) {
+			return end <= FLASH_SETTINGS_OFFSET ? start : 0;
+		}
+		start = clash->offset + PAGES(clash->length) * FLASH_PAGE_SIZE;
+	}
+}
+
+// Start writing a slot, replacing anything in it. A tune is length bytes.
+// A clip is length bytes of IMA-ADPCM at sampleRate. Stops playback.
+// Returns false if there is no room.
+bool libraryBegin(int slot, LibraryKind kind, char const *name,
+		uint32_t length, uint16_t sampleRate) {
+	if (slot < 0 || slot >= LIBRARY_SLOTS || length == 0) {
+		return false;
+	}
+	if (kind == LIBRARY_CLIP && (sampleRate == 0 || sampleRate > AUDIO_SAMPLE_RATE)) {
+		return false;
+	}
+	if (!libraryDelete(slot)) {
+		return false;
+	}
+
+	memset(&writing, 0, sizeof(writing));
+	writing.magic = LIBRARY_MAGIC;
+	writing.kind = kind;
+	writing.length = length + (kind == LIBRARY_CLIP ? sizeof(Clip) : 0);
+	strncpy(writing.name, name, LIBRARY_NAME_MAX - 1);
+	writing.offset = libraryAllocate(writing.length, slot);
+	if (!writing.offset) {
+		return false;
+	}
+	writingSlot = slot;
+	written = 0;
+	memset(page, 0xff, sizeof(page));
+
+	if (kind == LIBRARY_CLIP) {
+		// The clip is played straight from flash, so it points at its own
+		// index entry for the name and at the samples that follow it
+		LibraryEntry const *entry = (LibraryEntry const *) flashStoreAddress(slot * FLASH_PAGE_SIZE);
+		Clip clip = {
+			.name = entry->name,
+			.sampleRate = sampleRate,
+			.numSamples = length * 2,
+			.data = flashStoreAddress(writing.offset + sizeof(Clip)),
+		};
+		memcpy(page, &clip, sizeof(clip));
+		written = sizeof(clip);
+	}
+	return true;
+}
+
+// Add bytes to the slot being written. Returns false if there are too many
+// or they could not be written.
+bool libraryAppend(uint8_t const *data, uint32_t len) {
+	if (written + len > writing.length) {
+		return false;
+	}
+	while (len) {
+		uint32_t inPage = written % FLASH_PAGE_SIZE;
+		uint32_t n = min(len, FLASH_PAGE_SIZE - inPage);
+		memcpy((uint8_t *) page + inPage, data, n);
+		written += n;
+		data += n;
+		len -= n;
+		if (written % FLASH_PAGE_SIZE == 0) {
+			if (!flashStoreWrite(writing.offset + written - FLASH_PAGE_SIZE, page)) {
+				return false;
+			}
+			memset(page, 0xff, sizeof(page));
+		}
+	}
+	return true;
+}
+
+// Finish writing. Returns false, leaving the slot empty, if the data is not
+// complete and valid.
+bool libraryEnd(void) {
+	if (written != writing.length) {
+		return false;
+	}
+	if (written % FLASH_PAGE_SIZE &&
+			!flashStoreWrite(writing.offset + written - written % FLASH_PAGE_SIZE, page)) {
+		return false;
+	}
+	uint8_t const *data = flashStoreAddress(writing.offset);
+	if (writing.kind == LIBRARY_TUNE && !tuneValidate(data, writing.length)) {
+		return false;
+	}
+	writing.crc = crc16(0xffff, data, writing.length);
+	return libraryWriteIndex(writingSlot, &writing, sizeof(writing));
+}
+
+// Empty a slot. Stops playback.
+bool libraryDelete(int slot) {
+	if (slot < 0 || slot >= LIBRARY_SLOTS) {
+		return false;
+	}
+	libraryStopPlayback();
+	return !libraryEntry(slot) || libraryWriteIndex(slot, NULL, 0);
+}
+
+// Whether the data of an entry matches its CRC
+bool libraryVerify(LibraryEntry const *e) {
+	return crc16(0xffff, libraryData(e), e->length) == e->crc;
+}
+
+// Size of the largest free space in the library, in bytes
+uint32_t libraryFree(void) {
+	uint32_t largest = 0;
+	uint32_t start = LIBRARY_DATA_START;
+	while (start < FLASH_SETTINGS_OFFSET) {
+		// Next entry at or after start
+		LibraryEntry const *next = NULL;
+		for (int s = 0; s < LIBRARY_SLOTS; s++) {
+			LibraryEntry const *e = libraryEntry(s);
+			if (e && e->offset >= start && (!next || e->offset < next->offset)) {
+				next = e;
+			}
+		}
+		uint32_t end = next ? next->offset : FLASH_SETTINGS_OFFSET;
+		largest = max(largest, end - start);
+		if (!next) {
+			break;
+		}
+		start = next->offset + PAGES(next->length) * FLASH_PAGE_SIZE;
+	}
+	return largest;
+}
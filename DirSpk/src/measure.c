@@ -0,0 +1,160 @@
+// measure.c
+//
+// Loopback frequency response measurement.
+//
+// A log sweep exactly MEASURE_LEN samples long is played repeatedly while
+// one ADC channel is captured. Since the excitation is periodic, dividing
+// the spectrum of a captured period by the spectrum of the excitation gives
+// the response of the whole output and input chain without windowing. The
+// inverse transform of that response is the impulse response.
+
+#include "decls.h"
+
+// Time to let the output settle before capturing
+#define MEASURE_SETTLE_MS 100
+
+// Bins where the excitation has less than this fraction of its peak power
+// are not reported
+#define MEASURE_MIN_POWER 1e-3f
+
+// Captured periods, summed
+static int32_t captured[MEASURE_LEN];
+
+// Work buffers. The CMSIS real FFT uses its input as scratch space, so
+// buffers are reused as the measurement proceeds. Once complete, excitation
+// holds the magnitude response in dB and response holds the impulse response.
+static float32_t excitation[MEASURE_LEN];
+static float32_t response[MEASURE_LEN];
+static float32_t transfer[MEASURE_LEN];
+
+static arm_rfft_fast_instance_f32 fft;
+
+// Regenerate the excitation, aligned so that excitation[0] is the sample
+// that was played at the start of the capture.
+static void measureExcitation(SignalParams const *params, uint32_t start) {
+	SignalGenerator g;
+	siggenInit(&g, params);
+	for (int i = 0; i < MEASURE_LEN; i++) {
+		// Scale to DACC counts, as played
+		response[i] = siggenSample(&g) * (audioParams()->volume / 255.0f) * (2046.0f / 32768);
+	}
+	for (int i = 0; i < MEASURE_LEN; i++) {
+		excitation[i] = response[(start + i) % MEASURE_LEN];
+	}
+}
+
+// Average the captured periods and remove DC
+static void measureCaptured(uint32_t periods) {
+	float32_t mean = 0;
+	for (int i = 0; i < MEASURE_LEN; i++) {
+		response[i] = (float32_t) captured[i] / periods;
+		mean += response[i];
+	}
+	mean /= MEASURE_LEN;
+	for (int i = 0; i < MEASURE_LEN; i++) {
+		response[i] -= mean;
+	}
+}
+
+// Divide the response spectrum (in excitation) by the excitation spectrum
+// (in transfer), leaving the transfer function in transfer. Also writes
+// magnitudes to excitation, which is safe because bin k is written after
+// bins 0..k, held at indexes 0..2k+1, have been read.
+static void measureDivide(void) {
+	float32_t *y = excitation;
+	float32_t *x = transfer;
+
+	// Find peak excitation power
+	float32_t peak = 0;
+	for (int k = 1; k < MEASURE_LEN / 2; k++) {
+		peak = max(peak, x[2 * k] * x[2 * k] + x[2 * k + 1] * x[2 * k + 1]);
+	}
+
+	// DC and Nyquist are packed into the first pair, and not reported
+	x[0] = 0;
+	x[1] = 0;
+	y[0] = MEASURE_NO_DATA;
+	for (int k = 1; k < MEASURE_LEN / 2; k++) {
+		float32_t xr = x[2 * k], xi = x[2 * k + 1];
+		float32_t yr = y[2 * k], yi = y[2 * k + 1];
+		float32_t power = xr * xr + xi * xi;
+		// No excitation at all, say at volume 0, would divide 0 by 0
+		if (peak == 0 || power < peak * MEASURE_MIN_POWER) {
+			x[2 * k] = 0;
+			x[2 * k + 1] = 0;
+			y[k] = MEASURE_NO_DATA;
+			continue;
+		}
+		float32_t hr = (yr * xr + yi * xi) / power;
+		float32_t hi = (yi * xr - yr * xi) / power;
+		x[2 * k] = hr;
+		x[2 * k + 1] = hi;
+		y[k] = 10 * log10f(hr * hr + hi * hi);
+	}
+}
+
+// Measure the response of the loop from DACC and PWM output back to ADC
+// channel chan, using a sweep from f0 to f1 Hz averaged over periods
+// repetitions. Blocks the calling task. Leaves audio mode AM_OFF.
+// Returns false if the capture could not be made.
+bool measureRun(uint32_t f0, uint32_t f1, uint32_t periods, uint32_t chan) {
+	if (arm_rfft_fast_init_f32(&fft, MEASURE_LEN) != ARM_MATH_SUCCESS) {
+		return false;
+	}
+
+	// Start the sweep and let everything settle
+	SignalParams params = {
+		.type = SIG_SWEEP,
+		.freq = {f0, f1},
+		.sweepSamples = MEASURE_LEN,
+	};
+	adc_enable_channel(ADC, (enum adc_channel_num_t) chan);
+	audioModeSet(AM_SIGGEN);
+	siggenStart(&params);
+	vTaskDelay(MS_TO_TICKS(MEASURE_SETTLE_MS));
+
+	// Wait for the spectrum analyser to finish with the capture. Timeouts
+	// compare elapsed ticks, which are right even when the count wraps.
+	portTickType begin = xTaskGetTickCount();
+	while (!captureStart(captured, MEASURE_LEN, periods, chan)) {
+		if (xTaskGetTickCount() - begin >= MS_TO_TICKS(MEASURE_SETTLE_MS)) {
+			audioModeSet(AM_OFF);
+			return false;
+		}
+		vTaskDelay(1);
+	}
+
+	// Capture, allowing twice the expected time
+	begin = xTaskGetTickCount();
+	portTickType limit = MS_TO_TICKS(2 * 1000 * MEASURE_LEN * periods / AUDIO_SAMPLE_RATE + 10);
+	while (!captureIsDone() && xTaskGetTickCount() - begin < limit) {
+		vTaskDelay(1);
+	}
+	audioModeSet(AM_OFF);
+	if (!captureIsDone()) {
+		return false;
+	}
+
+	// Transform excitation into transfer, response into excitation
+	measureExcitation(&params, captureStartPosition());
+	measureCaptured(periods);
+	arm_rfft_fast_f32(&fft, excitation, transfer, 0);
+	arm_rfft_fast_f32(&fft, response, excitation, 0);
+
+	// Transfer function, then impulse response
+	measureDivide();
+	arm_rfft_fast_f32(&fft, transfer, response, 1);
+	return true;
+}
+
+// Magnitude response in dB, MEASURE_LEN / 2 bins, each
+// AUDIO_SAMPLE_RATE / MEASURE_LEN Hz wide. Bins that were not excited
+// hold MEASURE_NO_DATA. Valid after measureRun returns true.
+float32_t const *measureMagnitudeDb(void) {
+	return excitation;
+}
+
+// Impulse response, MEASURE_LEN samples. Valid after measureRun returns true.
+float32_t const *measureImpulse(void) {
+	return response;
+}
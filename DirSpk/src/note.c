@@ -21,40 +21,75 @@
 // 40 is middle C (C4), and 49 is middle A (A4) = 440Hz
 //
 
-// Table of frequencies for the 10th octave, generated with this python snippet
-// >>> x = math.pow(2.0, (1./12))
-// >>> for i in range(0, 12):
-// ...     print 440 * (2**6) * pow(x, (i-9))
-// The tenth octave is well beyond human hearing, and mostly beyond the speaker
-// but that's fine.
-static uint32_t freqTable[] = {
-    16744,
-	17740,
-	18795,
-	19912,
-	21096,
-	22350,
-	23679,
-	25087,
-	26580,
-	28160,
-	29834,
-	31609
+// Frequency and synth phase increment tables, in notes.c, are generated by
+// make_notes.py for every octave, so no precision is lost in low octaves.
+// The table in use is selected by temperament, and each note of the scale
+// can be detuned by up to 100 cents.
+
+// Temperament in use. Written by CLI.
+static volatile Temperament temperament;
+
+// Detune of each note, in cents and as a multiplier with 30 bits of
+// fraction. Written by CLI.
+static int8_t detuneCents[12];
+static volatile uint32_t detuneFactor[12] = {
+	[0 ... 11] = 1 << 30,
 };
 
-// From a numbered note, derive a frequency. Returns 0 on error
-uint32_t noteToFrequency(uint8_t note) {
+// Index into the note tables, or -1 if not a valid note
+static int noteIndex(uint8_t note) {
 	uint8_t i = note & 0xf;
-	if (i >= 12) {
+	uint16_t o = (note & 0xf0) >> 4;
+	if (i >= 12 || o >= NOTE_OCTAVES) {
+		return -1;
+	}
+	return o * 12 + i;
+}
+
+// Apply detune for note to value from a note table
+static uint32_t noteDetune(uint8_t note, uint32_t value) {
+	return (((uint64_t) value) * detuneFactor[note & 0xf]) >> 30;
+}
+
+// From a numbered note, derive a frequency in Hz with 16 bits of fraction.
+// Returns 0 on error
+uint32_t noteToFrequency(uint8_t note) {
+	int index = noteIndex(note);
+	if (index < 0) {
 		return 0;
 	}
-	uint16_t o = (note & 0xf0) >> 4;
-	if (o > 10) {
+	return noteDetune(note, noteFrequencies[temperament][index]);
+}
+
+// From a numbered note, derive a synth phase increment. Returns 0 on error
+uint32_t noteToIncrement(uint8_t note) {
+	int index = noteIndex(note);
+	if (index < 0) {
 		return 0;
 	}
-	return freqTable[i] >> (10 - o);
+	return noteDetune(note, noteIncrements[temperament][index]);
+}
+
+// Select the temperament used for all notes
+void noteTemperamentSet(Temperament t) {
+	temperament = t;
 }
 
+// The temperament in use
+Temperament noteTemperamentGet(void) {
+	return temperament;
+}
+
+// Detune note n of the scale (0 = C to 11 = B) by -100 to 100 cents
+void noteDetuneSet(uint8_t n, int8_t cents) {
+	detuneCents[n] = cents;
+	detuneFactor[n] = powf(2, cents / 1200.0f) * (1 << 30);
+}
+
+// Detune of note n of the scale, in cents
+int8_t noteDetuneGet(uint8_t n) {
+	return detuneCents[n];
+}
 
 // Table of indexes to notes
 static char const *nameTable[] = {
@@ -71,6 +106,13 @@ void noteToName(uint8_t note, char *p) {
 }
 
 
+// Move a note by a number of semitones, staying within the note tables
+uint8_t noteTranspose(uint8_t note, int semitones) {
+	int n = ((note & 0xf0) >> 4) * 12 + (note & 0xf) + semitones;
+	n = min(max(n, 0), NOTE_OCTAVES * 12 - 1);
+	return ((n / 12) << 4) + (n % 12);
+}
+
 // Go up one note
 uint8_t noteIncrement(uint8_t note) {
 	if ((note & 0xf) == 0xb) {
@@ -0,0 +1,265 @@
+// Generated note tables file.
+//
+// The code to generate this file is in make_notes.py. Do not edit by hand -
+// change and re-run the python instead.
+//
+// Largest pitch error from rounding: 0.000679 cents
+
+#include "decls.h"
+
+char const *const temperamentNames[NUM_TEMPERAMENTS] = {
+  "equal",
+  "just",
+  "pythagorean",
+  "meantone",
+  "werckmeister",
+};
+
+// Frequency of each note in Hz, 16 bits of fraction
+uint32_t const noteFrequencies[NUM_TEMPERAMENTS][NOTE_OCTAVES * 12] = {
+  { // equal
+       1071618,    1135340,    1202851,    1274376,    1350154,    1430439,
+       1515497,    1605613,    1701088,    1802240,    1909407,    2022946,
+       2143237,    2270680,    2405702,    2548752,    2700309,    2860878,
+       3030994,    3211227,    3402176,    3604480,    3818814,    4045892,
+       4286473,    4541360,    4811404,    5097505,    5400618,    5721755,
+       6061989,    6422453,    6804352,    7208960,    7637627,    8091784,
+       8572947,    9082720,    9622807,   10195009,   10801236,   11443511,
+      12123977,   12844906,   13608704,   14417920,   15275254,   16183568,
+      17145893,   18165441,   19245614,   20390018,   21602472,   22887021,
+      24247954,   25689813,   27217409,   28835840,   30550508,   32367136,
+      34291786,   36330882,   38491228,   40780036,   43204943,   45774043,
+      48495909,   51379626,   54434817,   57671680,   61101017,   64734272,
+      68583572,   72661764,   76982457,   81560072,   86409886,   91548086,
+      96991818,  102759252,  108869635,  115343360,  122202033,  129468544,
+     137167144,  145323527,  153964914,  163120144,  172819773,  183096171,
+     193983636,  205518503,  217739269,  230686720,  244404066,  258937088,
+     274334289,  290647054,  307929828,  326240288,  345639545,  366192342,
+     387967272,  411037006,  435478539,  461373440,  488808132,  517874176,
+     548668578,  581294109,  615859655,  652480576,  691279090,  732384684,
+     775934544,  822074013,  870957077,  922746880,  977616265, 1035748353,
+    1097337155, 1162588218, 1231719311, 1304961152, 1382558180, 1464769368,
+    1551869087, 1644148025, 1741914154, 1845493760, 1955232530, 2071496706,
+  },
+  { // just
+       1081344,    1153434,    1216512,    1297613,    1351680,    1441792,
+       1520640,    1622016,    1730150,    1802240,    1946419,    2027520,
+       2162688,    2306867,    2433024,    2595226,    2703360,    2883584,
+       3041280,    3244032,    3460301,    3604480,    3892838,    4055040,
+       4325376,    4613734,    4866048,    5190451,    5406720,    5767168,
+       6082560,    6488064,    6920602,    7208960,    7785677,    8110080,
+       8650752,    9227469,    9732096,   10380902,   10813440,   11534336,
+      12165120,   12976128,   13841203,   14417920,   15571354,   16220160,
+      17301504,   18454938,   19464192,   20761805,   21626880,   23068672,
+      24330240,   25952256,   27682406,   28835840,   31142707,   32440320,
+      34603008,   36909875,   38928384,   41523610,   43253760,   46137344,
+      48660480,   51904512,   55364813,   57671680,   62285414,   64880640,
+      69206016,   73819750,   77856768,   83047219,   86507520,   92274688,
+      97320960,  103809024,  110729626,  115343360,  124570829,  129761280,
+     138412032,  147639501,  155713536,  166094438,  173015040,  184549376,
+     194641920,  207618048,  221459251,  230686720,  249141658,  259522560,
+     276824064,  295279002,  311427072,  332188877,  346030080,  369098752,
+     389283840,  415236096,  442918502,  461373440,  498283315,  519045120,
+     553648128,  590558003,  622854144,  664377754,  692060160,  738197504,
+     778567680,  830472192,  885837005,  922746880,  996566630, 1038090240,
+    1107296256, 1181116006, 1245708288, 1328755507, 1384120320, 1476395008,
+    1557135360, 1660944384, 1771674010, 1845493760, 1993133261, 2076180480,
+  },
+  { // pythagorean
+       1067994,    1125130,    1201493,    1265771,    1351680,    1423992,
+       1520640,    1601991,    1687694,    1802240,    1898656,    2027520,
+       2135988,    2250259,    2402987,    2531542,    2703360,    2847984,
+       3041280,    3203982,    3375389,    3604480,    3797312,    4055040,
+       4271976,    4500518,    4805973,    5063083,    5406720,    5695968,
+       6082560,    6407964,    6750777,    7208960,    7594625,    8110080,
+       8543953,    9001036,    9611947,   10126166,   10813440,   11391937,
+      12165120,   12815929,   13501555,   14417920,   15189249,   16220160,
+      17087905,   18002073,   19223893,   20252332,   21626880,   22783874,
+      24330240,   25631858,   27003109,   28835840,   30378498,   32440320,
+      34175810,   36004146,   38447787,   40504664,   43253760,   45567747,
+      48660480,   51263716,   54006219,   57671680,   60756996,   64880640,
+      68351621,   72008292,   76895573,   81009328,   86507520,   91135494,
+      97320960,  102527431,  108012438,  115343360,  121513992,  129761280,
+     136703241,  144016584,  153791147,  162018657,  173015040,  182270989,
+     194641920,  205054862,  216024875,  230686720,  243027985,  259522560,
+     273406483,  288033167,  307582293,  324037313,  346030080,  364541977,
+     389283840,  410109724,  432049751,  461373440,  486055970,  519045120,
+     546812966,  576066334,  615164587,  648074626,  692060160,  729083955,
+     778567680,  820219449,  864099502,  922746880,  972111939, 1038090240,
+    1093625932, 1152132669, 1230329173, 1296149253, 1384120320, 1458167909,
+    1557135360, 1640438898, 1728199003, 1845493760, 1944223879, 2076180480,
+  },
+  { // meantone
+       1077991,    1153434,    1205231,    1289578,    1347489,    1441792,
+       1506538,    1611972,    1724786,    1802240,    1928369,    2014966,
+       2155982,    2306867,    2410461,    2579156,    2694977,    2883584,
+       3013076,    3223945,    3449571,    3604480,    3856738,    4029931,
+       4311964,    4613734,    4820922,    5158312,    5389955,    5767168,
+       6026153,    6447890,    6899142,    7208960,    7713475,    8059862,
+       8623928,    9227469,    9641844,   10316624,   10779910,   11534336,
+      12052305,   12895780,   13798284,   14417920,   15426951,   16119725,
+      17247855,   18454938,   19283688,   20633247,   21559819,   23068672,
+      24104611,   25791559,   27596568,   28835840,   30853901,   32239449,
+      34495711,   36909875,   38567377,   41266495,   43119638,   46137344,
+      48209221,   51583119,   55193137,   57671680,   61707803,   64478898,
+      68991421,   73819750,   77134754,   82532990,   86239276,   92274688,
+      96418442,  103166237,  110386274,  115343360,  123415606,  128957797,
+     137982842,  147639501,  154269507,  165065980,  172478553,  184549376,
+     192836884,  206332475,  220772548,  230686720,  246831212,  257915594,
+     275965684,  295279002,  308539015,  330131960,  344957106,  369098752,
+     385673769,  412664950,  441545095,  461373440,  493662424,  515831187,
+     551931369,  590558003,  617078030,  660263920,  689914211,  738197504,
+     771347537,  825329900,  883090190,  922746880,  987324848, 1031662375,
+    1103862738, 1181116006, 1234156060, 1320527840, 1379828422, 1476395008,
+    1542695075, 1650659800, 1766180381, 1845493760, 1974649696, 2063324750,
+  },
+  { // werckmeister
+       1078904,    1136623,    1205571,    1278701,    1351680,    1438538,
+       1515497,    1612882,    1704934,    1802240,    1918051,    2027520,
+       2157807,    2273246,    2411141,    2557401,    2703360,    2877077,
+       3030994,    3225765,    3409869,    3604480,    3836102,    4055040,
+       4315615,    4546491,    4822282,    5114803,    5406720,    5754153,
+       6061989,    6451529,    6819737,    7208960,    7672204,    8110080,
+       8631230,    9092983,    9644565,   10229606,   10813440,   11508306,
+      12123977,   12903058,   13639474,   14417920,   15344409,   16220160,
+      17262460,   18185966,   19289130,   20459212,   21626880,   23016613,
+      24247954,   25806116,   27278949,   28835840,   30688817,   32440320,
+      34524919,   36371932,   38578259,   40918423,   43253760,   46033226,
+      48495909,   51612233,   54557898,   57671680,   61377635,   64880640,
+      69049839,   72743863,   77156519,   81836846,   86507520,   92066452,
+      96991818,  103224466,  109115795,  115343360,  122755269,  129761280,
+     138099678,  145487727,  154313037,  163673693,  173015040,  184132904,
+     193983636,  206448932,  218231590,  230686720,  245510539,  259522560,
+     276199356,  290975454,  308626075,  327347385,  346030080,  368265808,
+     387967272,  412897864,  436463180,  461373440,  491021077,  519045119,
+     552398711,  581950907,  617252149,  654694770,  692060160,  736531616,
+     775934544,  825795728,  872926361,  922746880,  982042155, 1038090239,
+    1104797423, 1163901815, 1234504298, 1309389540, 1384120319, 1473063231,
+    1551869087, 1651591455, 1745852721, 1845493760, 1964084310, 2076180478,
+  },
+};
+
+// Synth phase increment of each note at 40000Hz
+uint32_t const noteIncrements[NUM_TEMPERAMENTS][NOTE_OCTAVES * 12] = {
+  { // equal
+       1755739,    1860141,    1970751,    2087938,    2212093,    2343631,
+       2482991,    2630637,    2787063,    2952790,    3128372,    3314395,
+       3511479,    3720282,    3941502,    4175876,    4424186,    4687262,
+       4965981,    5261274,    5574125,    5905580,    6256744,    6628789,
+       7022958,    7440565,    7883004,    8351751,    8848372,    9374524,
+       9931962,   10522547,   11148251,   11811160,   12513488,   13257579,
+      14045916,   14881129,   15766007,   16703503,   17696745,   18749048,
+      19863924,   21045095,   22296501,   23622320,   25026976,   26515158,
+      28091831,   29762258,   31532014,   33407005,   35393489,   37498096,
+      39727849,   42090189,   44593002,   47244640,   50053953,   53030316,
+      56183662,   59524517,   63064029,   66814011,   70786979,   74996192,
+      79455697,   84180379,   89186005,   94489281,  100107906,  106060631,
+     112367325,  119049034,  126128057,  133628022,  141573958,  149992383,
+     158911395,  168360758,  178372009,  188978561,  200215811,  212121263,
+     224734649,  238098067,  252256115,  267256044,  283147915,  299984767,
+     317822789,  336721516,  356744019,  377957122,  400431622,  424242525,
+     449469299,  476196134,  504512230,  534512088,  566295831,  599969533,
+     635645578,  673443031,  713488038,  755914244,  800863244,  848485051,
+     898938597,  952392268, 1009024459, 1069024176, 1132591661, 1199939066,
+    1271291156, 1346886062, 1426976075, 1511828488, 1601726488, 1696970102,
+    1797877195, 1904784536, 2018048919, 2138048352, 2265183323, 2399878133,
+    2542582312, 2693772124, 2853952150, 3023656976, 3203452976, 3393940203,
+  },
+  { // just
+       1771674,    1889786,    1993133,    2126009,    2214593,    2362232,
+       2491417,    2657511,    2834678,    2952790,    3189013,    3321889,
+       3543348,    3779571,    3986267,    4252018,    4429185,    4724464,
+       4982833,    5315022,    5669357,    5905580,    6378026,    6643778,
+       7086696,    7559142,    7972533,    8504035,    8858370,    9448928,
+       9965666,   10630044,   11338714,   11811160,   12756053,   13287555,
+      14173392,   15118285,   15945066,   17008070,   17716740,   18897856,
+      19931333,   21260088,   22677427,   23622320,   25512106,   26575110,
+      28346784,   30236570,   31890132,   34016141,   35433480,   37795712,
+      39862665,   42520176,   45354855,   47244640,   51024211,   53150220,
+      56693568,   60473140,   63780264,   68032282,   70866960,   75591424,
+      79725330,   85040352,   90709709,   94489281,  102048423,  106300441,
+     113387137,  120946279,  127560529,  136064564,  141733921,  151182849,
+     159450661,  170080705,  181419419,  188978561,  204096846,  212600881,
+     226774273,  241892558,  255121057,  272129128,  283467842,  302365698,
+     318901322,  340161410,  362838837,  377957122,  408193692,  425201762,
+     453548546,  483785116,  510242115,  544258256,  566935683,  604731395,
+     637802643,  680322820,  725677674,  755914244,  816387384,  850403525,
+     907097093,  967570232, 1020484230, 1088516511, 1133871366, 1209462791,
+    1275605287, 1360645639, 1451355349, 1511828488, 1632774767, 1700807049,
+    1814194186, 1935140465, 2040968459, 2177033023, 2267742732, 2418925581,
+    2551210574, 2721291279, 2902710697, 3023656976, 3265549534, 3401614098,
+  },
+  { // pythagorean
+       1749801,    1843412,    1968527,    2073839,    2214593,    2333069,
+       2491417,    2624702,    2765118,    2952790,    3110758,    3321889,
+       3499603,    3686825,    3937053,    4147678,    4429185,    4666137,
+       4982833,    5249404,    5530237,    5905580,    6221516,    6643778,
+       6999206,    7373649,    7874107,    8295355,    8858370,    9332275,
+       9965666,   10498809,   11060474,   11811160,   12443033,   13287555,
+      13998412,   14747298,   15748213,   16590710,   17716740,   18664549,
+      19931333,   20997618,   22120947,   23622320,   24886066,   26575110,
+      27996824,   29494596,   31496427,   33181421,   35433480,   37329098,
+      39862665,   41995236,   44241894,   47244640,   49772131,   53150220,
+      55993648,   58989193,   62992854,   66362842,   70866960,   74658197,
+      79725330,   83990472,   88483789,   94489281,   99544263,  106300441,
+     111987295,  117978385,  125985707,  132725683,  141733921,  149316394,
+     159450661,  167980943,  176967578,  188978561,  199088525,  212600881,
+     223974591,  235956771,  251971415,  265451367,  283467842,  298632788,
+     318901322,  335961886,  353935156,  377957122,  398177050,  425201762,
+     447949182,  471913541,  503942829,  530902734,  566935683,  597265576,
+     637802643,  671923773,  707870312,  755914244,  796354101,  850403525,
+     895898363,  943827082, 1007885659, 1061805468, 1133871366, 1194531151,
+    1275605287, 1343847545, 1415740624, 1511828488, 1592708202, 1700807049,
+    1791796727, 1887654165, 2015771318, 2123610935, 2267742732, 2389062302,
+    2551210574, 2687695090, 2831481247, 3023656976, 3185416403, 3401614098,
+  },
+  { // meantone
+       1766180,    1889786,    1974650,    2112845,    2207725,    2362232,
+       2468312,    2641056,    2825889,    2952790,    3159440,    3301320,
+       3532361,    3779571,    3949299,    4225689,    4415451,    4724464,
+       4936624,    5282111,    5651777,    5905580,    6318879,    6602639,
+       7064722,    7559142,    7898599,    8451378,    8830902,    9448928,
+       9873248,   10564223,   11303554,   11811160,   12637758,   13205278,
+      14129443,   15118285,   15797198,   16902756,   17661804,   18897856,
+      19746497,   21128445,   22607109,   23622320,   25275516,   26410557,
+      28258886,   30236570,   31594395,   33805513,   35323608,   37795712,
+      39492994,   42256891,   45214218,   47244640,   50551032,   52821114,
+      56517772,   60473140,   63188790,   67611025,   70647215,   75591424,
+      78985988,   84513782,   90428435,   94489281,  101102064,  105642227,
+     113035544,  120946279,  126377581,  135222051,  141294430,  151182849,
+     157971976,  169027563,  180856871,  188978561,  202204129,  211284454,
+     226071089,  241892558,  252755161,  270444102,  282588861,  302365698,
+     315943951,  338055127,  361713742,  377957122,  404408258,  422568909,
+     452142177,  483785116,  505510322,  540888203,  565177722,  604731395,
+     631887903,  676110254,  723427484,  755914244,  808816515,  845137817,
+     904284355,  967570232, 1011020644, 1081776406, 1130355444, 1209462791,
+    1263775805, 1352220508, 1446854968, 1511828488, 1617633031, 1690275635,
+    1808568710, 1935140465, 2022041289, 2163552813, 2260710887, 2418925581,
+    2527551611, 2704441016, 2893709936, 3023656976, 3235266062, 3380551270,
+  },
+  { // werckmeister
+       1767676,    1862243,    1975207,    2095023,    2214593,    2356901,
+       2482991,    2642546,    2793364,    2952790,    3142535,    3321889,
+       3535352,    3724486,    3950414,    4190047,    4429185,    4713802,
+       4965981,    5285093,    5586729,    5905580,    6285070,    6643778,
+       7070704,    7448972,    7900828,    8380093,    8858370,    9427605,
+       9931962,   10570185,   11173457,   11811160,   12570140,   13287555,
+      14141407,   14897943,   15801655,   16760186,   17716740,   18855209,
+      19863924,   21140371,   22346915,   23622320,   25140279,   26575110,
+      28282814,   29795886,   31603310,   33520372,   35433480,   37710419,
+      39727849,   42280741,   44693830,   47244640,   50280558,   53150220,
+      56565628,   59591773,   63206620,   67040744,   70866960,   75420837,
+      79455697,   84561483,   89387659,   94489281,  100561117,  106300440,
+     113131256,  119183546,  126413240,  134081489,  141733921,  150841675,
+     158911395,  169122965,  178775319,  188978561,  201122233,  212600881,
+     226262512,  238367092,  252826480,  268162978,  283467841,  301683350,
+     317822789,  338245930,  357550637,  377957122,  402244467,  425201762,
+     452525024,  476734183,  505652961,  536325956,  566935683,  603366700,
+     635645578,  676491860,  715101275,  755914244,  804488933,  850403524,
+     905050049,  953468367, 1011305921, 1072651911, 1133871366, 1206733399,
+    1271291156, 1352983720, 1430202549, 1511828488, 1608977866, 1700807048,
+    1810100098, 1906936733, 2022611842, 2145303823, 2267742731, 2413466798,
+    2542582312, 2705967440, 2860405099, 3023656976, 3217955733, 3401614095,
+  },
+};
+
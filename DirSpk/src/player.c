@@ -0,0 +1,173 @@
+// player.c
+//
+// Plays tunes by driving synth voices.
+//
+// The player is advanced once per millisecond from the FreeRTOS tick hook.
+// Tasks ask for a tune to start or stop through single-word requests, which
+// the tick hook picks up on its next call. Each voice of a tune is read and
+// timed separately, on its own synth voice.
+
+#include "decls.h"
+
+// Requests from tasks. Cleared by the tick hook.
+static uint8_t const *volatile startRequest;
+static volatile bool stopRequest;
+
+// Number of voices still playing. Owner: tick hook.
+static volatile int playing;
+
+// Tempo, with 8 bits of fraction, and transpose in semitones.
+// Written by tasks, picked up by the tick hook within a millisecond.
+static volatile uint16_t tempo = PLAYER_TEMPO_UNITY;
+static volatile int8_t transpose;
+
+// Everything for one voice of the tune playing
+typedef struct {
+	// Reads the voice straight from flash
+	TuneReader reader;
+	
+	// The event playing, and whether it has reached its gap
+	TuneEvent event;
+	bool inGap;
+	
+	// Whether the voice has finished
+	bool done;
+	
+	// When the note or gap ends, in TUNE_TIME_UNIT_MS
+	uint32_t endAt;
+} PlayerVoice;
+
+// Voices of the tune playing. Owner: tick hook.
+static PlayerVoice voices[TUNE_MAX_VOICES];
+static int numVoices;
+
+// Time since start of tune in ms, scaled by tempo, with 8 bits of
+// fraction. Owner: tick hook.
+static uint32_t elapsed;
+
+// Transpose applied to the notes sounding. Owner: tick hook.
+static int8_t soundingTranspose;
+
+// Start playing a tune, replacing any tune already playing
+void playerStart(uint8_t const *tune) {
+	stopRequest = false;
+	startRequest = tune;
+}
+
+// Stop playing
+void playerStop(void) {
+	startRequest = NULL;
+	stopRequest = true;
+}
+
+// Whether a tune is playing
+bool playerIsPlaying(void) {
+	return playing || startRequest != NULL;
+}
+
+// Silence every voice of the tune
+static void playerSilence(void) {
+	for (int v = 0; v < numVoices; v++) {
+		synthNoteOff(PLAYER_VOICE + v);
+	}
+	playing = 0;
+}
+
+// Sound the note of voice v's event. Note zero is a rest.
+static void playerSound(int v) {
+	TuneEvent const *e = &voices[v].event;
+	if (e->note) {
+		synthNoteOn(PLAYER_VOICE + v, noteToIncrement(noteTranspose(e->note, soundingTranspose)));
+	} else {
+		synthNoteOff(PLAYER_VOICE + v);
+	}
+}
+
+// Move voice v on to the gap after its note, or its next event
+static void playerAdvance(int v) {
+	PlayerVoice *pv = voices + v;
+	if (!pv->inGap && pv->event.gap) {
+		pv->inGap = true;
+		pv->endAt += pv->event.gap;
+		synthNoteOff(PLAYER_VOICE + v);
+	} else if (tuneReaderNext(&pv->reader, &pv->event)) {
+		pv->inGap = false;
+		pv->endAt += pv->event.duration;
+		playerSound(v);
+	} else {
+		pv->done = true;
+		playing--;
+		synthNoteOff(PLAYER_VOICE + v);
+	}
+}
+
+// Advance the player by one millisecond.
+// Executes from within the tick interrupt
+void playerTick(void) {
+	if (stopRequest) {
+		stopRequest = false;
+		playerSilence();
+	}
+	if (startRequest) {
+		playerSilence();
+		uint8_t const *tune = startRequest;
+		startRequest = NULL;
+		numVoices = tuneVoices(tune);
+		playing = numVoices;
+		elapsed = 0;
+		soundingTranspose = transpose;
+		for (int v = 0; v < numVoices; v++) {
+			PlayerVoice *pv = voices + v;
+			tuneReaderInit(&pv->reader, tune, v);
+			pv->inGap = true;
+			pv->event.gap = 0;
+			pv->done = false;
+			pv->endAt = 0;
+			playerAdvance(v);
+		}
+	}
+	if (!playing) {
+		return;
+	}
+
+	// Retune the sounding notes if transpose has changed
+	if (transpose != soundingTranspose) {
+		soundingTranspose = transpose;
+		for (int v = 0; v < numVoices; v++) {
+			PlayerVoice const *pv = voices + v;
+			if (!pv->done && !pv->inGap && pv->event.note) {
+				synthPitchSet(PLAYER_VOICE + v,
+					noteToIncrement(noteTranspose(pv->event.note, soundingTranspose)));
+			}
+		}
+	}
+
+	elapsed += tempo;
+	for (int v = 0; v < numVoices; v++) {
+		PlayerVoice *pv = voices + v;
+		while (!pv->done && elapsed >= (pv->endAt * TUNE_TIME_UNIT_MS) << 8) {
+			playerAdvance(v);
+		}
+	}
+}
+
+// Set the tempo, with 8 bits of fraction: PLAYER_TEMPO_UNITY plays tunes as
+// written. Takes effect immediately, even part way through a note.
+void playerTempoSet(uint16_t t) {
+	tempo = min(max(t, PLAYER_TEMPO_MIN), PLAYER_TEMPO_MAX);
+}
+
+// The tempo, with 8 bits of fraction
+uint16_t playerTempoGet(void) {
+	return tempo;
+}
+
+// Set the transpose in semitones. The sounding note is retuned at once.
+void playerTransposeSet(int8_t semitones) {
+	transpose = min(max(semitones, -PLAYER_TRANSPOSE_MAX), PLAYER_TRANSPOSE_MAX);
+}
+
+// The transpose in semitones
+int8_t playerTransposeGet(void) {
+	return transpose;
+}
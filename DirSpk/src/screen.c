@@ -323,15 +323,20 @@ static void screenElementDefaultInit(ScreenElement *p) {
 	    10, 5, COL_silver, COL_black);
 }
 
-// Write a bold font string centered on a point, in 4x font
-static void screenWriteOnPoint(uint16_t x, uint16_t y, char *p) {
-	uint16_t w = strlen(p) * 8 * 4;
-	int16_t h = 16 * 4;
+// Write a bold font string centered on a point, in (size + 1)x font
+static void screenWriteSizedOnPoint(uint16_t x, uint16_t y, char *p, uint8_t size) {
+	uint16_t w = strlen(p) * 8 * (size + 1);
+	int16_t h = 16 * (size + 1);
 	lcdSetBoldFont();
-	lcdSetTextParams(x - w / 2, y - h / 2, 3, 3);
+	lcdSetTextParams(x - w / 2, y - h / 2, size, size);
 	lcdWriteString(p);
 }
 
+// Write a bold font string centered on a point, in 4x font
+static void screenWriteOnPoint(uint16_t x, uint16_t y, char *p) {
+	screenWriteSizedOnPoint(x, y, p, 3);
+}
+
 // Standard update - write value in center-ish of area
 static void screenElementDefaultUpdate(ScreenElement *p) {
 	// Get out quickly if can
@@ -355,6 +360,39 @@ static void screenElementDefaultUpdate(ScreenElement *p) {
 	p->lastValue = p->value;
 }
 
+// Silence gate settings, shown under its state
+typedef struct {
+	uint8_t thresholdDb;
+	uint16_t holdMs;
+	uint8_t lastThresholdDb;
+	uint16_t lastHoldMs;
+} GateSettings;
+
+// Silence gate update - show whether the bridge is shut down, and the
+// threshold and hold time
+static void screenElementGateUpdate(ScreenElement *p) {
+	GateSettings *g = p->pData;
+	if (p->isTouched == p->lastIsTouched && p->value == p->lastValue &&
+			g->thresholdDb == g->lastThresholdDb && g->holdMs == g->lastHoldMs) {
+		return;
+	}
+	
+	lcdSetActiveWindow(p->x0, p->y0, p->x1, p->y1);
+	lcdRoundedRect(p->x0 + 2, p->y0 + 2, p->x1 - 2, p->y1 - 2, 
+	    10, 5, COL_silver, p->isTouched ? COL_silver : COL_black);
+	
+	lcdSetForegroundColor(p->value ? COL_gray : COL_lime);
+	uint16_t w = p->x1 - p->x0;
+	uint16_t h = p->y1 - p->y0;
+	screenWriteOnPoint(p->x0 + w / 2, p->y0 + h / 2 - 14, p->value ? "GATED" : "OPEN");
+	snprintf(buf, BUF_LEN, "-%udB %ums", g->thresholdDb, g->holdMs);
+	screenWriteSizedOnPoint(p->x0 + w / 2, p->y1 - 24, buf, 1);
+	
+	p->lastIsTouched = p->isTouched;
+	p->lastValue = p->value;
+	g->lastThresholdDb = g->thresholdDb;
+	g->lastHoldMs = g->holdMs;
+}
 
 //
 // Code for individual modes
@@ -483,16 +521,24 @@ static ScreenElement inputRightVu = {
 };
 static ScreenElement inputGain = {
 	.id = 3,
-	.x0 = 480, .y0 = 0, .x1 = 799, .y1 = 179,
+	.x0 = 480, .y0 = 0, .x1 = 799, .y1 = 119,
 	.init = screenElementDefaultInit,
 	.update = screenElementDefaultUpdate,
 };
 static ScreenElement inputFade = {
 	.id = 4,
-	.x0 = 480, .y0 = 180, .x1 = 799, .y1 = 359,
+	.x0 = 480, .y0 = 120, .x1 = 799, .y1 = 239,
 	.init = screenElementDefaultInit,
 	.update = screenElementDefaultUpdate,
 };
+static GateSettings inputGateSettings;
+static ScreenElement inputGate = {
+	.id = 6,
+	.x0 = 480, .y0 = 240, .x1 = 799, .y1 = 359,
+	.init = screenElementDefaultInit,
+	.update = screenElementGateUpdate,
+	.pData = &inputGateSettings,
+};
 static ScreenElement inputModeSwitch = {
 	.id = 5,
 	.x0 = 480, .y0 = 360, .x1 = 799, .y1 = 479,
@@ -505,7 +551,7 @@ static ScreenElement inputModeSwitch = {
 // The list of elements for the input mode
 static ScreenElement *inputElements[] = {
 	&inputLeftVu, &inputRightVu, 
-	&inputGain, &inputFade, &inputModeSwitch, 
+	&inputGain, &inputFade, &inputGate, &inputModeSwitch, 
 	NULL
 };
 
@@ -523,6 +569,9 @@ static void screenShowInput(ScreenCommand cmd) {
 	inputRightVu.value = cmd.rightLevel;
 	inputGain.value = cmd.gain;
 	inputFade.value = cmd.fade;
+	inputGate.value = cmd.gated;
+	inputGateSettings.thresholdDb = cmd.gateThresholdDb;
+	inputGateSettings.holdMs = cmd.gateHoldMs;
 	
 	// Update touched. Determine if element released
 	LcdTouchCoords t = lcdGetTouch();
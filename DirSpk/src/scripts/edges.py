@@ -0,0 +1,100 @@
+#!/usr/bin/python
+#
+# Captures encoder edges from DirSpk1 with the et command, and decodes them
+# into a trace for the host encoder harness (host/encoder_harness.c).
+#
+#   python edges.py port seconds > trace.txt
+#   python edges.py dump.bin > trace.txt
+#
+# With a port, runs et for that many seconds and decodes its dump. With a
+# file, decodes a dump saved from the CLI, from its "edges" line on. The
+# trace goes to standard output and a summary to standard error. Needs
+# pyserial to use a port.
+#
+# Runs with Python 2.7 or Python 3.
+#
+
+from __future__ import print_function
+
+import struct
+import sys
+
+# Must match decls.h
+CYCLES_PER_US = 84
+NUM_ENCODERS = 4
+ENCODER_SHIFT = 12
+EDGE = struct.Struct("<II")
+
+BAUD_RATE = 115200
+
+
+def read_line(read):
+    # Read up to and including a newline
+    line = b''
+    while not line.endswith(b"\n"):
+        c = read(1)
+        if not c:
+            sys.exit("Timed out or ran out, got %r" % line)
+        line += c
+    return line
+
+
+def read_dump(read):
+    # Returns the snapshots taken, the cycle count at the start and the
+    # (cycles, pins) snapshots kept
+    while True:
+        words = read_line(read).split()
+        if len(words) == 4 and words[0] == b"edges":
+            break
+    (count, kept, start) = (int(w) for w in words[1:])
+    data = read(kept * EDGE.size)
+    if len(data) != kept * EDGE.size:
+        sys.exit("Dump cut short: %d of %d bytes" % (len(data), kept * EDGE.size))
+    edges = [EDGE.unpack_from(data, i * EDGE.size) for i in range(kept)]
+    return (count, start, edges)
+
+
+def decode(start, edges, out):
+    # Write a harness trace line for every change of an encoder's signals.
+    # Everything is written for the first snapshot, as the pins before it
+    # are not known. Returns the lines written.
+    lines = 0
+    last = None
+    for (cycles, pins) in edges:
+        # The run is under 51s, so the cycle count wraps at most once
+        us = ((cycles - start) & 0xffffffff) // CYCLES_PER_US
+        for num in range(NUM_ENCODERS):
+            signals = (pins >> (ENCODER_SHIFT + 2 * num)) & 3
+            if last is None or signals != (last >> (ENCODER_SHIFT + 2 * num)) & 3:
+                out.write("%d %d %d\n" % (us, num, signals))
+                lines += 1
+        last = pins
+    return lines
+
+
+def main():
+    args = sys.argv[1:]
+    if len(args) == 2:
+        import serial
+        (port_name, seconds) = args
+        port = serial.Serial(port_name, BAUD_RATE, timeout=int(seconds) + 3)
+        port.write(("et %s\r" % seconds).encode())
+        (count, start, edges) = read_dump(port.read)
+    elif len(args) == 1:
+        with open(args[0], "rb") as f:
+            (count, start, edges) = read_dump(f.read)
+    else:
+        sys.exit("Use: edges.py port seconds, or edges.py dump.bin")
+
+    out = sys.stdout
+    out.write("# us encoder signals\n")
+    lines = decode(start, edges, out)
+    print("%d interrupts, %d kept, %d edges" % (count, len(edges), lines),
+          file=sys.stderr)
+    if count > len(edges):
+        print("The first %d interrupts were overwritten" % (count - len(edges)),
+              file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
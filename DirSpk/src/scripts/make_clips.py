@@ -0,0 +1,185 @@
+#!/usr/bin/python
+#
+# Builds C code that embeds short audio clips, compressed with IMA-ADPCM.
+#
+# A few reference signals are always generated. WAV files may be added as
+# arguments in the form name=file.wav. They must be 16 bit PCM, and only the
+# first channel is used. Files above 40kHz are resampled to 40kHz.
+#
+#   python make_clips.py [name=file.wav ...] > ../clips.c
+#
+# Runs with Python 2.7 or Python 3.
+#
+
+from __future__ import print_function
+
+import math
+import struct
+import sys
+import wave
+
+# Sample rate for generated clips. The firmware interpolates up to 40kHz.
+REF_RATE = 10000
+
+# Highest clip sample rate - must match AUDIO_SAMPLE_RATE in decls.h
+MAX_RATE = 40000
+
+# IMA-ADPCM tables - these must match clip.c
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+]
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8] * 2
+
+
+def clamp(v, lo, hi):
+    return max(lo, min(hi, v))
+
+
+def adpcm_encode(samples):
+    """Encode a list of 16 bit samples as a list of 4 bit codes."""
+    predictor = 0
+    index = 0
+    codes = []
+    for s in samples:
+        step = STEP_TABLE[index]
+        diff = s - predictor
+        code = 0
+        if diff < 0:
+            code = 8
+            diff = -diff
+        # Quantize, tracking the decoder's reconstruction exactly
+        delta = step >> 3
+        if diff >= step:
+            code |= 4
+            diff -= step
+            delta += step
+        step >>= 1
+        if diff >= step:
+            code |= 2
+            diff -= step
+            delta += step
+        step >>= 1
+        if diff >= step:
+            code |= 1
+            delta += step
+        if code & 8:
+            predictor -= delta
+        else:
+            predictor += delta
+        predictor = clamp(predictor, -32768, 32767)
+        index = clamp(index + INDEX_TABLE[code], 0, len(STEP_TABLE) - 1)
+        codes.append(code)
+    return codes
+
+
+def pack_codes(codes):
+    """Two codes per byte, first code in the low nibble."""
+    if len(codes) % 2:
+        codes = codes + [0]
+    return [codes[i] | (codes[i + 1] << 4) for i in range(0, len(codes), 2)]
+
+
+def tone(freq, seconds, level=0.7):
+    n = int(REF_RATE * seconds)
+    return [int(32767 * level * math.sin(2 * math.pi * freq * i / REF_RATE))
+            for i in range(n)]
+
+
+def chime(seconds=0.6):
+    # Two decaying partials - a gentle attention signal
+    n = int(REF_RATE * seconds)
+    out = []
+    for i in range(n):
+        t = float(i) / REF_RATE
+        env = math.exp(-t * 6) * min(1.0, t * 200)
+        v = 0.5 * math.sin(2 * math.pi * 880 * t) + 0.3 * math.sin(2 * math.pi * 1320 * t)
+        out.append(int(32767 * env * v))
+    return out
+
+
+def read_wav(path):
+    w = wave.open(path, 'rb')
+    if w.getsampwidth() != 2:
+        raise ValueError("%s: only 16 bit WAV files are supported" % path)
+    channels = w.getnchannels()
+    frames = w.readframes(w.getnframes())
+    values = struct.unpack('<%dh' % (len(frames) // 2), frames)
+    rate = w.getframerate()
+    samples = list(values[::channels])
+    if rate > MAX_RATE:
+        samples = resample(samples, rate, MAX_RATE)
+        rate = MAX_RATE
+    return rate, samples
+
+
+def resample(samples, rate, new_rate):
+    # Linear interpolation. Only content above new_rate / 2 aliases, and
+    # from 44.1 or 48kHz that is at most the top few kHz.
+    out = []
+    step = float(rate) / new_rate
+    for i in range(int((len(samples) - 1) / step) + 1):
+        pos = i * step
+        j = int(pos)
+        frac = pos - j
+        nxt = samples[min(j + 1, len(samples) - 1)]
+        out.append(int(round(samples[j] + (nxt - samples[j]) * frac)))
+    return out
+
+
+def print_clip(var_name, name, rate, samples):
+    data = pack_codes(adpcm_encode(samples))
+    print("// %s: %d samples at %dHz, %d bytes (%d bytes as 16 bit PCM)" % (
+        name, len(samples), rate, len(data), len(samples) * 2))
+    print("static uint8_t const %sData[] = {" % var_name)
+    for i in range(0, len(data), 16):
+        print("  " + " ".join("0x%02x," % b for b in data[i:i + 16]))
+    print("};")
+    print("static Clip const %s = {" % var_name)
+    print("  .name = \"%s\"," % name)
+    print("  .sampleRate = %d," % rate)
+    print("  .numSamples = %d," % len(samples))
+    print("  .data = %sData," % var_name)
+    print("};")
+    print("")
+
+
+def main():
+    clip_list = [
+        ("ref1k", REF_RATE, tone(1000, 0.5)),
+        ("ref440", REF_RATE, tone(440, 0.5)),
+        ("chime", REF_RATE, chime()),
+    ]
+    for arg in sys.argv[1:]:
+        name, path = arg.split('=', 1)
+        rate, samples = read_wav(path)
+        clip_list.append((name, rate, samples))
+
+    print("""// Generated clips file.
+//
+// The code to generate this file is in make_clips.py. Do not edit by hand -
+// change and re-run the python instead.
+
+#include "decls.h"
+""")
+
+    for (i, (name, rate, samples)) in enumerate(clip_list):
+        print_clip("clip%d" % i, name, rate, samples)
+
+    print("Clip const *const clips[] = {")
+    for i in range(len(clip_list)):
+        print("  &clip%d," % i)
+    print("  NULL,")
+    print("};")
+
+
+# Also imported by upload.py
+if __name__ == "__main__":
+    main()
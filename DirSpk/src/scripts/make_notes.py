@@ -0,0 +1,149 @@
+#!/usr/bin/python
+#
+# Builds C code with fixed point frequency and synth phase increment tables
+# for every note in every octave, in several temperaments.
+#
+#   python make_notes.py > ../notes.c
+#
+# All temperaments are tuned with A4 = 440Hz. The order of TEMPERAMENTS must
+# match the Temperament enum in decls.h.
+#
+# Runs with Python 2.7 or Python 3.
+#
+
+from __future__ import print_function
+
+import math
+import sys
+
+# Must match decls.h
+OCTAVES = 11
+SAMPLE_RATE = 40000
+FREQ_FRACTION_BITS = 16
+
+A4 = 440.0
+
+
+def cents(ratio):
+    return 1200 * math.log(ratio, 2)
+
+
+def from_cents(c):
+    return 2 ** (c / 1200.0)
+
+
+def equal():
+    return [from_cents(100 * i) for i in range(12)]
+
+
+def just():
+    # Five limit just intonation, on C
+    return [1.0, 16 / 15.0, 9 / 8.0, 6 / 5.0, 5 / 4.0, 4 / 3.0,
+            45 / 32.0, 3 / 2.0, 8 / 5.0, 5 / 3.0, 9 / 5.0, 15 / 8.0]
+
+
+def fifths(fifth, flats):
+    # Stack fifths up from C, and 'flats' fifths down, folded into one octave
+    ratios = [0] * 12
+    for n in range(-flats, 12 - flats):
+        r = fifth ** n
+        while r >= 2:
+            r /= 2
+        while r < 1:
+            r *= 2
+        ratios[(7 * n) % 12] = r
+    return ratios
+
+
+def pythagorean():
+    return fifths(1.5, 5)
+
+
+def meantone():
+    # Quarter comma: fifths narrowed so that four make a pure major third
+    return fifths(5 ** 0.25, 5)
+
+
+def werckmeister():
+    # Werckmeister III, in cents from C
+    c = [0, 90.225, 192.18, 294.135, 390.225, 498.045,
+         588.27, 696.09, 792.18, 888.27, 996.09, 1092.18]
+    return [from_cents(x) for x in c]
+
+
+TEMPERAMENTS = [
+    ("equal", equal()),
+    ("just", just()),
+    ("pythagorean", pythagorean()),
+    ("meantone", meantone()),
+    ("werckmeister", werckmeister()),
+]
+
+
+def frequencies(ratios):
+    # C4 chosen so that A4 is 440Hz
+    c4 = A4 / ratios[9]
+    return [c4 * (2 ** (octave - 4)) * ratios[note]
+            for octave in range(OCTAVES) for note in range(12)]
+
+
+def to_fixed(hz):
+    return int(round(hz * (1 << FREQ_FRACTION_BITS)))
+
+
+def to_increment(hz):
+    return int(round(hz * (1 << 32) / SAMPLE_RATE))
+
+
+def max_error_cents(table, fixed, scale):
+    return max(abs(cents(f * scale / t)) for (t, f) in zip(table, fixed))
+
+
+def print_table(c_type, var_name, rows, comment):
+    print("// %s" % comment)
+    print("%s const %s[NUM_TEMPERAMENTS][NOTE_OCTAVES * 12] = {" % (c_type, var_name))
+    for (name, values) in rows:
+        print("  { // %s" % name)
+        for i in range(0, len(values), 6):
+            print("    " + " ".join("%10d," % v for v in values[i:i + 6]))
+        print("  },")
+    print("};")
+    print("")
+
+
+freq_rows = []
+inc_rows = []
+worst = 0
+for (name, ratios) in TEMPERAMENTS:
+    table = frequencies(ratios)
+    fixed = [to_fixed(f) for f in table]
+    incs = [to_increment(f) for f in table]
+    worst = max(worst,
+                max_error_cents(table, fixed, 1.0 / (1 << FREQ_FRACTION_BITS)),
+                max_error_cents(table, incs, float(SAMPLE_RATE) / (1 << 32)))
+    freq_rows.append((name, fixed))
+    inc_rows.append((name, incs))
+
+if worst >= 1:
+    sys.exit("Pitch error %f cents is too high" % worst)
+
+print("""// Generated note tables file.
+//
+// The code to generate this file is in make_notes.py. Do not edit by hand -
+// change and re-run the python instead.
+//
+// Largest pitch error from rounding: %.6f cents
+
+#include "decls.h"
+""" % worst)
+
+print("char const *const temperamentNames[NUM_TEMPERAMENTS] = {")
+for (name, _) in TEMPERAMENTS:
+    print("  \"%s\"," % name)
+print("};")
+print("")
+
+print_table("uint32_t", "noteFrequencies", freq_rows,
+            "Frequency of each note in Hz, 16 bits of fraction")
+print_table("uint32_t", "noteIncrements", inc_rows,
+            "Synth phase increment of each note at %dHz" % SAMPLE_RATE)
@@ -2,11 +2,21 @@
 #
 # Builds C code that embeds tables of notes that make up tunes.
 #
+#   python make_tables.py [tune1.mid [tune2.mid]] > ../tunes.c
+#
+# Standard MIDI files given on the command line replace the hand written
+# tunes, in order. All tracks and channels except drums are merged, timed
+# with the file's tempo map, and spread across as many voices as needed.
+#
 # This output is a complete, though ugly, source file.
 #
-# Built with Python2.7
+# Runs with Python 2.7 or Python 3.
 #
 
+from __future__ import print_function
+
+import sys
+
 ODE_TO_JOY = [
     ("B4", 0.25), ("B4", 0.25), ("C5", 0.25), ("D5", 0.25),
     ("D5", 0.25), ("C5", 0.25), ("B4", 0.25), ("A4", 0.25),
@@ -29,10 +39,30 @@ ODE_TO_JOY = [
     ("A4", 0.375), ("G4", 0.125), ("G4", 0.50),
 ]
 
+TWINKLE = [
+    ("C4", 0.25), ("C4", 0.25), ("G4", 0.25), ("G4", 0.25),
+    ("A4", 0.25), ("A4", 0.25), ("G4", 0.50),
+    ("F4", 0.25), ("F4", 0.25), ("E4", 0.25), ("E4", 0.25),
+    ("D4", 0.25), ("D4", 0.25), ("C4", 0.50),
+
+    ("G4", 0.25), ("G4", 0.25), ("F4", 0.25), ("F4", 0.25),
+    ("E4", 0.25), ("E4", 0.25), ("D4", 0.50),
+    ("G4", 0.25), ("G4", 0.25), ("F4", 0.25), ("F4", 0.25),
+    ("E4", 0.25), ("E4", 0.25), ("D4", 0.50),
+
+    ("C4", 0.25), ("C4", 0.25), ("G4", 0.25), ("G4", 0.25),
+    ("A4", 0.25), ("A4", 0.25), ("G4", 0.50),
+    ("F4", 0.25), ("F4", 0.25), ("E4", 0.25), ("E4", 0.25),
+    ("D4", 0.25), ("D4", 0.25), ("C4", 0.50),
+]
+
 # beats per minute and MS per whole note (4 beats)
 BPM = 96
 MS_PER_WHOLE = 60.0 / BPM * 4 * 1000
+# Gap between notes. The synth releases each note during the gap, so that
+# repeated notes are heard separately.
 INTER_NOTE_PAUSE_MS = 16
+GAP = 1
 NOTES = {
     'C': 0,
     'C#': 1,
@@ -53,32 +83,334 @@ NOTES = {
     'B': 11
 }
 
+# Compact tune format, read by tune.c. Each tune starts with the number of
+# voices and the 16 bit offset of each voice's data from the start of the
+# tune. The data for each voice is a byte stream:
+#
+#   Header: number of durations, the durations, the gap and the first note.
+#   Durations and gap are in TIME_UNIT_MS units.
+#
+#   Events are one byte, dddd iiii:
+#     dddd: index into the duration table of the length of the note, or 15
+#           for an escape
+#     iiii: 0 for a rest, otherwise the interval in semitones from the
+#           previous note plus 8
+#   Every note, but not a rest, is followed by an implied rest of the gap.
+#
+#   Escapes:
+#     0xf0: end of tune
+#     0xf1 note lo hi: any note (0 for rest) with a 16 bit duration
+#
+# Must match decls.h
+TIME_UNIT_MS = 16
+ESCAPE = 0xf
+ESCAPE_END = 0x0
+ESCAPE_LONG = 0x1
+INTERVAL_ZERO = 8
+MAX_DURATIONS = 15
+MAX_VOICES = 4
+
 def encode_note(note_str):
     # Octave goes into high nybble, note into low nybble
-    return "0x%c%1x" % (note_str[1], NOTES[note_str[0]])
+    return (int(note_str[-1]) << 4) + NOTES[note_str[:-1]]
 
-def encode_end(time):
-    # Integer division
-    return time / 16
+def semitones(note):
+    return (note >> 4) * 12 + (note & 0xf)
 
-def print_data(var_name, data_in, tempo):
+def timed_events(data_in):
+    # Returns (note, duration) in time units, with the gap between notes
+    # left implied. End times are rounded just as the player sees them.
     end_time = 0
-    print "TuneData %s[] = {" % var_name
+    end_at = 0
+    events = []
     for (note_str, duration) in data_in:
         end_time += int(duration * MS_PER_WHOLE) - INTER_NOTE_PAUSE_MS
-        print "  {%s, 0x%04x}," % (encode_note(note_str), encode_end(end_time))
+        note_end = end_time // TIME_UNIT_MS
+        events.append((encode_note(note_str), note_end - end_at))
         end_time += INTER_NOTE_PAUSE_MS
-        print "  {0x00, 0x%04x}," % encode_end(end_time)
-    print "  {0x00, 0xffff},"
-    print "};"
+        end_at = end_time // TIME_UNIT_MS
+        assert end_at - note_end == GAP
+    return events
+
+def encode(events, gap):
+    # Most common durations get table entries
+    counts = {}
+    for (_, d) in events:
+        if d < 256:
+            counts[d] = counts.get(d, 0) + 1
+    durations = sorted(counts, key=lambda d: -counts[d])[:MAX_DURATIONS]
+
+    previous = [n for (n, _) in events if n][0]
+    out = [len(durations)] + durations + [gap, previous]
+    for (note, d) in events:
+        if note:
+            interval = semitones(note) - semitones(previous)
+        if d in durations and (not note or -7 <= interval <= 7):
+            code = INTERVAL_ZERO + interval if note else 0
+            out.append((durations.index(d) << 4) + code)
+        else:
+            out += [(ESCAPE << 4) + ESCAPE_LONG, note, d & 0xff, d >> 8]
+        if note:
+            previous = note
+    out.append((ESCAPE << 4) + ESCAPE_END)
+    return out
+
+def encode_tune(voices, gap):
+    # Voice count and offsets, then each voice
+    out = [len(voices)] + [0, 0] * len(voices)
+    for (v, events) in enumerate(voices):
+        out[1 + 2 * v] = len(out) & 0xff
+        out[2 + 2 * v] = len(out) >> 8
+        data = encode(events, gap)
+        assert decode(data) == events
+        out += data
+    assert len(out) < 0x10000
+    return out
+
+# Decodes as tune.c does, to check the encoding
+def decode(data):
+    n = data[0]
+    durations = data[1:1 + n]
+    gap = data[1 + n]
+    previous = data[2 + n]
+    events = []
+    i = 3 + n
+    while True:
+        b = data[i]
+        i += 1
+        if b >> 4 == ESCAPE:
+            if b & 0xf == ESCAPE_END:
+                return events
+            note = data[i]
+            d = data[i + 1] + (data[i + 2] << 8)
+            i += 3
+        else:
+            d = durations[b >> 4]
+            note = 0
+            if b & 0xf:
+                n = semitones(previous) + (b & 0xf) - INTERVAL_ZERO
+                note = ((n // 12) << 4) + n % 12
+        if note:
+            previous = note
+        events.append((note, d))
+
+# Size of the old table format: padded 4 byte entries, with an explicit rest
+# after every note and an end marker
+def legacy_size(events):
+    return (2 * len(events) + 1) * 4
+
+#
+# MIDI import
+#
+
+# Channel 10 is percussion, which has no pitch
+DRUM_CHANNEL = 9
+
+def read_var(data, i):
+    # Variable length quantity, 7 bits per byte, most significant first
+    value = 0
+    while True:
+        b = data[i]
+        i += 1
+        value = (value << 7) + (b & 0x7f)
+        if not b & 0x80:
+            return (value, i)
+
+def read_chunks(data):
+    i = 0
+    while i + 8 <= len(data):
+        kind = data[i:i + 4]
+        length = (data[i + 4] << 24) + (data[i + 5] << 16) + (data[i + 6] << 8) + data[i + 7]
+        yield (kind, data[i + 8:i + 8 + length])
+        i += 8 + length
+
+def read_track(track):
+    # Returns (tick, kind, values) for tempo changes and notes on and off
+    events = []
+    tick = 0
+    status = 0
+    i = 0
+    while i < len(track):
+        (delta, i) = read_var(track, i)
+        tick += delta
+        if track[i] & 0x80:
+            status = track[i]
+            i += 1
+        if status == 0xff:
+            kind = track[i]
+            (length, i) = read_var(track, i + 1)
+            if kind == 0x51:
+                tempo = (track[i] << 16) + (track[i + 1] << 8) + track[i + 2]
+                events.append((tick, "tempo", tempo))
+            elif kind == 0x2f:
+                break
+            i += length
+            status = 0
+        elif status in (0xf0, 0xf7):
+            (length, i) = read_var(track, i)
+            i += length
+            status = 0
+        elif status >> 4 in (0x8, 0x9):
+            channel = status & 0xf
+            key, velocity = track[i], track[i + 1]
+            i += 2
+            if channel != DRUM_CHANNEL:
+                on = status >> 4 == 0x9 and velocity > 0
+                events.append((tick, "on" if on else "off", (channel, key)))
+        elif status >> 4 in (0xc, 0xd):
+            i += 1
+        elif status >> 4 in (0xa, 0xb, 0xe):
+            i += 2
+        else:
+            sys.exit("Bad MIDI data at byte %d of track" % i)
+    return events
+
+def read_midi(file_name):
+    # Returns notes as (start, end, MIDI key), times in ms
+    data = bytearray(open(file_name, "rb").read())
+    chunks = list(read_chunks(data))
+    if not chunks or chunks[0][0] != b"MThd":
+        sys.exit("%s is not a MIDI file" % file_name)
+    header = chunks[0][1]
+    division = (header[4] << 8) + header[5]
+    if division & 0x8000:
+        sys.exit("%s: SMPTE time is not supported" % file_name)
+
+    tracks = [read_track(t) for (kind, t) in chunks[1:] if kind == b"MTrk"]
+
+    # Tempo map applies to all tracks. Default is 120 BPM.
+    tempos = sorted((tick, tempo) for t in tracks
+                    for (tick, kind, tempo) in t if kind == "tempo")
+    def to_ms(tick):
+        ms = 0.0
+        (last_tick, last_tempo) = (0, 500000)
+        for (t, tempo) in tempos:
+            if t >= tick:
+                break
+            ms += (t - last_tick) * last_tempo / 1000.0 / division
+            (last_tick, last_tempo) = (t, tempo)
+        return ms + (tick - last_tick) * last_tempo / 1000.0 / division
+
+    notes = []
+    for (track_num, t) in enumerate(tracks):
+        held = {}
+        for (tick, kind, value) in t:
+            key = (track_num,) + value if kind != "tempo" else None
+            if kind == "on":
+                held.setdefault(key, []).append(tick)
+            elif kind == "off" and held.get(key):
+                start = held[key].pop(0)
+                notes.append((to_ms(start), to_ms(tick), value[1]))
+    return notes
 
-print """// Generated tunes file.
+def midi_note(key):
+    # MIDI key 60 is C4. Fold into the octaves the firmware has.
+    octave = min(max(key // 12 - 1, 0), 10)
+    return (octave << 4) + key % 12
+
+def allocate_voices(notes):
+    # Notes quantized to time units, highest first when they start together.
+    # Each note goes to the first voice free when it starts, which uses as
+    # few voices as possible. Returns notes for each voice, the most notes
+    # sounding at once and the number of notes dropped for lack of a voice.
+    timed = []
+    for (start, end, key) in notes:
+        (start, end) = (int(round(start / TIME_UNIT_MS)), int(round(end / TIME_UNIT_MS)))
+        if end > start:
+            timed.append((start, -key, end))
+    timed.sort()
+
+    voices = []
+    ends = []
+    # Ends of every note still sounding, dropped ones included
+    sounding = []
+    overlap = 0
+    dropped = 0
+    for (start, key, end) in timed:
+        sounding = [e for e in sounding if e > start] + [end]
+        overlap = max(overlap, len(sounding))
+        free = [v for v in range(len(voices)) if ends[v] <= start]
+        if free:
+            v = free[0]
+        elif len(voices) < MAX_VOICES:
+            v = len(voices)
+            voices.append([])
+            ends.append(0)
+        else:
+            dropped += 1
+            continue
+        voices[v].append((start, end, midi_note(-key)))
+        ends[v] = end
+    return (voices, overlap, dropped)
+
+def voice_events(notes):
+    # Notes with explicit rests between them, rests split to fit 16 bits
+    events = []
+    now = 0
+    for (start, end, note) in notes:
+        while start > now:
+            rest = min(start - now, 0xffff)
+            events.append((0, rest))
+            now += rest
+        events.append((note, min(end - start, 0xffff)))
+        now += events[-1][1]
+    return events
+
+def print_bytes(var_name, data, report):
+    sys.stderr.write(report + "\n")
+    print("// %s" % report)
+    print("uint8_t const %s[] = {" % var_name)
+    for i in range(0, len(data), 12):
+        print("  " + " ".join("0x%02x," % b for b in data[i:i + 12]))
+    print("};")
+
+def print_data(var_name, data_in):
+    events = timed_events(data_in)
+    data = encode_tune([events], GAP)
+    legacy = legacy_size(events)
+    print_bytes(var_name, data, "%s: %d bytes, was %d, saves %d" % (
+        var_name, len(data), legacy, legacy - len(data)))
+
+def midi_tune(file_name):
+    # Returns tune bytes and a report on the voices
+    (voices, overlap, dropped) = allocate_voices(read_midi(file_name))
+    if not voices:
+        sys.exit("%s has no notes" % file_name)
+    data = encode_tune([voice_events(v) for v in voices], 0)
+    report = "%d bytes, %d voices, at most %d notes overlap" % (
+        len(data), len(voices), overlap)
+    if dropped:
+        report += ", %d notes dropped" % dropped
+    return (data, report)
+
+def print_midi(var_name, file_name):
+    (data, report) = midi_tune(file_name)
+    print_bytes(var_name, data, "%s: %s" % (var_name, report))
+
+def main():
+    print("""// Generated tunes file.
 //
 // The code to generate this file is in make_tables.py. Do not edit by hand -
 // change and re-run the python instead.
 
 #include "decls.h"
-"""
+""")
+
+    midi_files = sys.argv[1:]
+    if len(midi_files) > 0:
+        print("// %s" % midi_files[0].split("/")[-1])
+        print_midi("tuneData1", midi_files[0])
+    else:
+        print("// Ode To Joy")
+        print_data("tuneData1", ODE_TO_JOY)
+    print("")
+    if len(midi_files) > 1:
+        print("// %s" % midi_files[1].split("/")[-1])
+        print_midi("tuneData2", midi_files[1])
+    else:
+        print("// Twinkle Twinkle Little Star")
+        print_data("tuneData2", TWINKLE)
 
-print "// Ode To Joy"
-print_data("tune1", ODE_TO_JOY, 500);
+# Also imported by upload_tune.py
+if __name__ == "__main__":
+    main()
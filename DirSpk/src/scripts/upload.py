@@ -0,0 +1,122 @@
+#!/usr/bin/python
+#
+# Sends a tune or clip to DirSpk1 over the CLI serial port.
+#
+#   python upload.py port ram slot tune.mid|tune.bin
+#   python upload.py port lib slot name tune.mid|tune.bin|clip.wav
+#
+# ram loads a tune into a RAM slot, lost at reset. lib writes a tune or clip
+# into a library slot in flash. MIDI files are converted as make_tables.py
+# does and WAV files as make_clips.py does. Any other file is sent as it is,
+# and must already be in the tune format. Needs pyserial.
+#
+# Runs with Python 2.7 or Python 3.
+#
+
+from __future__ import print_function
+
+import binascii
+import sys
+import time
+
+import serial
+
+import make_clips
+import make_tables
+
+# Must match decls.h
+SYNC = 0x55
+DATA = ord('D')
+END = ord('E')
+ACK = b'\x06'
+CAN = b'\x18'
+FRAME_MAX = 255
+
+BAUD_RATE = 115200
+RETRIES = 5
+
+
+def frame(sequence, kind, payload):
+    body = bytearray([sequence & 0xff, kind, len(payload)]) + payload
+    crc = binascii.crc_hqx(bytes(body), 0xffff)
+    return bytes(bytearray([SYNC]) + body + bytearray([crc & 0xff, crc >> 8]))
+
+
+def read_until(port, text):
+    # Read until text arrives. Returns everything read.
+    got = b''
+    while not got.endswith(text):
+        c = port.read(1)
+        if not c:
+            sys.exit("Timed out waiting for %r, got %r" % (text, got))
+        got += c
+    return got
+
+
+def send(port, data):
+    # Returns False if the board gave up on the upload
+    frames = [frame(i, DATA, data[offset:offset + FRAME_MAX])
+              for (i, offset) in enumerate(range(0, len(data), FRAME_MAX))]
+    frames.append(frame(len(frames), END, bytearray()))
+    for f in frames:
+        for _ in range(RETRIES):
+            port.write(f)
+            reply = port.read(1)
+            if reply == ACK:
+                break
+            if reply == CAN:
+                return False
+        else:
+            sys.exit("No ACK after %d tries" % RETRIES)
+    return True
+
+
+def load(file_name):
+    # Returns the bytes to send, the library kind and the clip sample rate
+    name = file_name.lower()
+    if name.endswith((".mid", ".midi")):
+        (data, report) = make_tables.midi_tune(file_name)
+        print("%s: %s" % (file_name, report))
+        return (bytearray(data), "t", None)
+    if name.endswith(".wav"):
+        (rate, samples) = make_clips.read_wav(file_name)
+        data = make_clips.pack_codes(make_clips.adpcm_encode(samples))
+        print("%s: %d samples at %dHz" % (file_name, len(samples), rate))
+        return (bytearray(data), "c", rate)
+    return (bytearray(open(file_name, "rb").read()), "t", None)
+
+
+def main():
+    args = sys.argv[1:]
+    if len(args) == 4 and args[1] == "ram":
+        (port_name, _, slot, file_name) = args
+        (data, kind, rate) = load(file_name)
+        if kind != "t":
+            sys.exit("Only tunes go in RAM slots")
+        command = "tu %s" % slot
+    elif len(args) == 5 and args[1] == "lib":
+        (port_name, _, slot, name, file_name) = args
+        (data, kind, rate) = load(file_name)
+        command = "lu %s %s %s %d" % (kind, slot, name, len(data))
+        if rate:
+            command += " %d" % rate
+    else:
+        sys.exit("Use: upload.py port ram slot file, or upload.py port lib slot name file")
+
+    port = serial.Serial(port_name, BAUD_RATE, timeout=3)
+    port.write((command + "\r").encode())
+    read_until(port, b"READY\r\n")
+
+    start = time.time()
+    if send(port, data):
+        seconds = time.time() - start
+        print("Sent %d bytes in %.2fs, %d bytes/s" % (len(data), seconds, len(data) / seconds))
+    else:
+        print("Upload cancelled by the board")
+
+    # Show how it went
+    print(read_until(port, b"*end*").decode(errors="replace").strip())
+
+
+if __name__ == "__main__":
+    main()
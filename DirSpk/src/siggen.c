@@ -0,0 +1,192 @@
+// siggen.c
+//
+// Test signal generator: log sweeps, noise and multi-tone signals for
+// characterizing the audio path.
+//
+// Every signal is fully determined by its SignalParams, including the seed,
+// so a measurement can regenerate exactly what was played. The audio
+// interrupt owns one generator; other code may run private generators.
+
+#include "decls.h"
+
+// Galois LFSR feedback masks for maximal length sequences, by order
+static uint16_t const mlsMasks[] = {
+	0, 0, 0, 0, // orders 0-3 not used
+	0x000c, 0x0014, 0x0030, 0x0060, 0x00b8, 0x0110, 0x0240,
+	0x0500, 0x0e08, 0x1c80, 0x3802, 0x6000, 0xd008,
+};
+
+// Xorshift random number generator - cheap and good enough for noise
+static inline uint32_t siggenRandom(SignalGenerator *g) {
+	uint32_t x = g->random;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	g->random = x;
+	return x;
+}
+
+// Phase increment for a frequency in Hz, with 32 bits of fraction
+static uint64_t siggenIncrement(uint32_t hz) {
+	uint64_t scaled = ((uint64_t) hz) << 32;
+	uint64_t whole = scaled / AUDIO_SAMPLE_RATE;
+	uint64_t remainder = scaled % AUDIO_SAMPLE_RATE;
+	return (whole << 32) + (remainder << 32) / AUDIO_SAMPLE_RATE;
+}
+
+// Largest sweep multiplier per block: it must fit Q30 in a uint32_t
+#define SIGGEN_SWEEP_MAX_RATIO 4.0f
+
+// Sweep frequency ratio per SIGGEN_SWEEP_BLOCK
+static float siggenSweepRatio(uint32_t f0, uint32_t f1, uint32_t samples) {
+	float blocks = (float) max(samples, 1) / SIGGEN_SWEEP_BLOCK;
+	float ratio = (float) f1 / max(f0, 1);
+	return expf(logf(ratio) / blocks);
+}
+
+// Whether a sweep from f0 to f1 Hz over samples samples can be generated
+bool siggenSweepValid(uint32_t f0, uint32_t f1, uint32_t samples) {
+	return samples >= SIGGEN_SWEEP_BLOCK &&
+		siggenSweepRatio(f0, f1, samples) < SIGGEN_SWEEP_MAX_RATIO;
+}
+
+// Set up a generator to produce the signal described by params
+void siggenInit(SignalGenerator *g, SignalParams const *params) {
+	memset(g, 0, sizeof(SignalGenerator));
+	g->params = *params;
+	g->random = params->seed ? params->seed : 1; // Must never be zero
+
+	switch (params->type) {
+		case SIG_SWEEP: {
+			// Multiply increment by a constant each block for an exponential sweep
+			g->increment[0] = siggenIncrement(params->freq[0]);
+			// Callers check siggenSweepValid; clamp anyway, as overflow is undefined
+			float ratio = siggenSweepRatio(params->freq[0], params->freq[1], params->sweepSamples);
+			g->sweepMultiplier = min(ratio, 3.999f) * (1 << 30);
+			break;
+		}
+		case SIG_MLS:
+			g->params.mlsOrder = min(max(params->mlsOrder, 4), 16);
+			g->random &= (1 << g->params.mlsOrder) - 1;
+			if (!g->random) {
+				g->random = 1;
+			}
+			break;
+		case SIG_PINK:
+			for (int i = 0; i < SIGGEN_PINK_ROWS; i++) {
+				g->pinkRows[i] = ((int32_t) siggenRandom(g)) >> 20;
+				g->pinkSum += g->pinkRows[i];
+			}
+			break;
+		case SIG_TONES:
+			for (int i = 0; i < SIGGEN_MAX_TONES; i++) {
+				if (params->freq[i]) {
+					g->increment[i] = siggenIncrement(params->freq[i]);
+					// Random start phases keep the crest factor down
+					g->phase[i] = siggenRandom(g);
+					g->numTones++;
+				}
+			}
+			break;
+	}
+}
+
+// Next sample of a log sweep
+static inline int32_t siggenSweep(SignalGenerator *g) {
+	if (g->count >= g->params.sweepSamples) {
+		// Start the next sweep
+		g->count = 0;
+		g->phase[0] = 0;
+		g->increment[0] = siggenIncrement(g->params.freq[0]);
+	}
+	if ((g->count % SIGGEN_SWEEP_BLOCK) == 0 && g->count) {
+		g->increment[0] = (g->increment[0] >> 30) * g->sweepMultiplier;
+	}
+	g->phase[0] += g->increment[0] >> 32;
+	return arm_sin_q15(g->phase[0] >> 17);
+}
+
+// Next sample of a maximal length sequence
+static inline int32_t siggenMls(SignalGenerator *g) {
+	uint32_t lsb = g->random & 1;
+	g->random >>= 1;
+	if (lsb) {
+		g->random ^= mlsMasks[g->params.mlsOrder];
+	}
+	return lsb ? 32767 : -32767;
+}
+
+// Next sample of pink noise, using the Voss-McCartney algorithm: row n is
+// updated every 2^n samples, and the rows are summed with white noise.
+static inline int32_t siggenPink(SignalGenerator *g) {
+	uint32_t row = __CLZ(__RBIT(g->count | (1 << (SIGGEN_PINK_ROWS - 1))));
+	int32_t value = ((int32_t) siggenRandom(g)) >> 20;
+	g->pinkSum += value - g->pinkRows[row];
+	g->pinkRows[row] = value;
+	int32_t white = ((int32_t) siggenRandom(g)) >> 20;
+	return __SSAT((g->pinkSum + white) * 2, 16);
+}
+
+// Next sample of a multi-tone signal
+static inline int32_t siggenTones(SignalGenerator *g) {
+	int32_t sum = 0;
+	for (int i = 0; i < g->numTones; i++) {
+		g->phase[i] += g->increment[i] >> 32;
+		sum += arm_sin_q15(g->phase[i] >> 17);
+	}
+	return g->numTones ? sum / g->numTones : 0;
+}
+
+// Produce the next sample, -32768 to 32767
+int32_t siggenSample(SignalGenerator *g) {
+	int32_t result = 0;
+	switch (g->params.type) {
+		case SIG_SWEEP:
+			result = siggenSweep(g);
+			break;
+		case SIG_MLS:
+			result = siggenMls(g);
+			break;
+		case SIG_PINK:
+			result = siggenPink(g);
+			break;
+		case SIG_TONES:
+			result = siggenTones(g);
+			break;
+	}
+	g->count++;
+	return result;
+}
+
+//
+// The generator used by the audio interrupt
+//
+
+// Two generators: one in use by the interrupt, the other being set up
+static SignalGenerator generators[2];
+static SignalGenerator *volatile activeGenerator;
+
+// Start the audio interrupt's generator producing a new signal
+void siggenStart(SignalParams const *params) {
+	SignalGenerator *g = (activeGenerator == generators) ? generators + 1 : generators;
+	siggenInit(g, params);
+	activeGenerator = g;
+}
+
+// Stop the audio interrupt's generator
+void siggenStop(void) {
+	activeGenerator = NULL;
+}
+
+// Produce the next sample for the audio interrupt, or 0 if stopped.
+// Executes from within an interrupt
+int32_t siggenNextSample(void) {
+	SignalGenerator *g = activeGenerator;
+	return g ? siggenSample(g) : 0;
+}
+
+// Position in the signal of the sample last produced for the audio interrupt
+uint32_t siggenPosition(void) {
+	SignalGenerator *g = activeGenerator;
+	return (g && g->count) ? g->count - 1 : 0;
+}
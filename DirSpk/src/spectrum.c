@@ -0,0 +1,145 @@
+// spectrum.c
+//
+// Background spectrum analyser.
+//
+// A low priority task captures a block of the audio input, applies a Hann
+// window and runs a q15 real FFT (the Cortex-M3 has no FPU), then sums the
+// bin powers into log spaced bands. The task runs below every other task
+// and at most once per SPECTRUM_PERIOD_MS, so its share of the CPU is
+// bounded and it can never starve the screen or CLI.
+
+#include "decls.h"
+
+// Samples per block
+#define SPECTRUM_LEN 512
+
+// Time between blocks
+#define SPECTRUM_PERIOD_MS 50
+
+// Magnitude of a full scale sine after the Hann window, the scaled down
+// q15 FFT and arm_cmplx_mag_q15
+#define SPECTRUM_FULL_SCALE 4096.0f
+
+// Captured samples, windowed block and FFT output
+static int32_t captured[SPECTRUM_LEN];
+static q15_t block[SPECTRUM_LEN];
+static q15_t transformed[SPECTRUM_LEN * 2];
+
+// Hann window, and first bin of each band. Set up by the task.
+static q15_t window[SPECTRUM_LEN];
+static uint16_t bandStart[SPECTRUM_BANDS + 1];
+
+static arm_rfft_instance_q15 fft;
+
+// Latest bands, dB relative to full scale. Written by spectrum task inside
+// a critical section.
+static int8_t bands[SPECTRUM_BANDS];
+static uint32_t frames;
+static uint32_t frameCycles;
+
+// Set up window and band edges
+static void spectrumInit(void) {
+	for (int i = 0; i < SPECTRUM_LEN; i++) {
+		window[i] = 16384 - arm_cos_q15(i * 32768 / SPECTRUM_LEN) / 2;
+	}
+
+	// Bands are log spaced from bin 1 to the Nyquist bin, but at least one
+	// bin wide
+	float ratio = logf(SPECTRUM_LEN / 2) / SPECTRUM_BANDS;
+	bandStart[0] = 1;
+	for (int b = 1; b <= SPECTRUM_BANDS; b++) {
+		uint16_t edge = expf(ratio * b) + 0.5f;
+		bandStart[b] = max(edge, bandStart[b - 1] + 1);
+	}
+	bandStart[SPECTRUM_BANDS] = SPECTRUM_LEN / 2;
+
+	ASSERT_BLINK(arm_rfft_init_q15(&fft, SPECTRUM_LEN, 0, 1) == ARM_MATH_SUCCESS, 1, 11);
+}
+
+// Window the captured block, transform it and update the bands
+static void spectrumAnalyse(void) {
+	int32_t mean = 0;
+	for (int i = 0; i < SPECTRUM_LEN; i++) {
+		mean += captured[i];
+	}
+	mean /= SPECTRUM_LEN;
+
+	// 12 bit ADC values to q15, windowed
+	for (int i = 0; i < SPECTRUM_LEN; i++) {
+		int32_t sample = __SSAT((captured[i] - mean) * 16, 16);
+		block[i] = (sample * window[i]) >> 15;
+	}
+	arm_rfft_q15(&fft, block, transformed);
+
+	// Magnitudes go back into block
+	arm_cmplx_mag_q15(transformed, block, SPECTRUM_LEN / 2);
+
+	int8_t levels[SPECTRUM_BANDS];
+	for (int b = 0; b < SPECTRUM_BANDS; b++) {
+		uint64_t power = 0;
+		for (int i = bandStart[b]; i < bandStart[b + 1]; i++) {
+			power += block[i] * block[i];
+		}
+		float db = 10 * log10f((power + 1) / (SPECTRUM_FULL_SCALE * SPECTRUM_FULL_SCALE));
+		levels[b] = min(max(db, -SPECTRUM_FLOOR_DB), 0);
+	}
+
+	taskENTER_CRITICAL();
+	memcpy(bands, levels, sizeof(bands));
+	frames++;
+	taskEXIT_CRITICAL();
+}
+
+// The spectrum task
+static void spectrumTask(void *pvParameters) {
+	spectrumInit();
+	portTickType wake = xTaskGetTickCount();
+	for (;;) {
+		vTaskDelayUntil(&wake, MS_TO_TICKS(SPECTRUM_PERIOD_MS));
+
+		// Skip this block if a measurement is using the capture
+		if (!captureStart(captured, SPECTRUM_LEN, 1, SPECTRUM_CHANNEL)) {
+			continue;
+		}
+		while (!captureIsDone()) {
+			vTaskDelay(1);
+		}
+
+		uint32_t start = DWT->CYCCNT;
+		spectrumAnalyse();
+		frameCycles = DWT->CYCCNT - start;
+	}
+}
+
+// Copy the latest bands, in dB relative to full scale, into levels.
+// Returns the number of blocks analysed so far.
+uint32_t spectrumGet(int8_t levels[SPECTRUM_BANDS]) {
+	taskENTER_CRITICAL();
+	memcpy(levels, bands, sizeof(bands));
+	uint32_t result = frames;
+	taskEXIT_CRITICAL();
+	return result;
+}
+
+// Centre frequency of band b in Hz
+uint32_t spectrumBandHz(int b) {
+	uint32_t bin = (bandStart[b] + bandStart[b + 1]) / 2;
+	return bin * AUDIO_SAMPLE_RATE / SPECTRUM_LEN;
+}
+
+// Cycles taken to analyse the last block
+uint32_t spectrumCycles(void) {
+	return frameCycles;
+}
+
+// Start the spectrum task
+void startSpectrum(void) {
+	portBASE_TYPE t = xTaskCreate(
+		spectrumTask,
+		USTR("SPECTRUM"),
+		configMINIMAL_STACK_SIZE * 2,
+		NULL,
+		tskIDLE_PRIORITY, // Below everything else
+		NULL);
+	ASSERT_BLINK(t, 2, 11);
+}
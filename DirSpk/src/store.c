@@ -0,0 +1,54 @@
+// store.c
+//
+// RAM slots for tunes loaded at run time. Lost at reset. The library keeps
+// tunes in flash.
+
+#include "decls.h"
+
+// RAM slots
+static struct {
+	uint32_t length;
+	uint8_t data[STORE_TUNE_MAX];
+} slots[STORE_RAM_SLOTS];
+
+// The slot being loaded, and how much is in it
+static int loading;
+static uint32_t loaded;
+
+// Empty a slot and start loading a tune into it
+void storeTuneBegin(int slot) {
+	loading = slot;
+	loaded = 0;
+	slots[slot].length = 0;
+}
+
+// Add bytes to the tune being loaded. Returns false if it is too big.
+bool storeTuneAppend(uint8_t const *data, uint32_t len) {
+	if (loaded + len > STORE_TUNE_MAX) {
+		return false;
+	}
+	memcpy(slots[loading].data + loaded, data, len);
+	loaded += len;
+	return true;
+}
+
+// Finish loading. Returns false, leaving the slot empty, if the tune is not
+// valid.
+bool storeTuneEnd(void) {
+	if (!tuneValidate(slots[loading].data, loaded)) {
+		return false;
+	}
+	slots[loading].length = loaded;
+	return true;
+}
+
+// The tune in a slot, or NULL if the slot is empty. Sets *len if not NULL.
+uint8_t const *storeTuneGet(int slot, uint32_t *len) {
+	if (slot < 0 || slot >= STORE_RAM_SLOTS || !slots[slot].length) {
+		return NULL;
+	}
+	if (len) {
+		*len = slots[slot].length;
+	}
+	return slots[slot].data;
+}
@@ -0,0 +1,172 @@
+// synth.c
+//
+// Synth voices for generated tones and tunes.
+//
+// Each voice is a phase accumulator whose top bit gives a square wave. The
+// square wave is scaled by an attack/decay/sustain/release envelope so that
+// notes start and stop without a click. All voices are advanced once per
+// sample from PWM_Handler, so the per-voice work is kept to a few adds and
+// compares.
+
+#include "decls.h"
+
+// Envelope level at full volume. Levels are shifted down by ENV_SHIFT to
+// give an amplitude of at most 8192, so four voices at full level together
+// just reach full scale.
+#define ENV_FULL (1 << 24)
+#define ENV_SHIFT 11
+#if NUM_VOICES > 4
+#error ENV_SHIFT leaves headroom for 4 voices
+#endif
+
+// Everything for a single voice
+typedef struct {
+	// Phase accumulator. Wraps at 2^32 once per cycle.
+	uint32_t phase;
+
+	// Added to phase each sample. Written by note on.
+	volatile uint32_t increment;
+
+	// Whether the note is held. Written by note on/off.
+	volatile bool gate;
+
+	// Incremented by note on to restart the envelope.
+	volatile uint8_t trigger;
+
+	// Envelope state. Owner: audio interrupt.
+	uint8_t seenTrigger;
+	EnvelopeStage stage;
+	int32_t level;
+} Voice;
+
+static Voice voices[NUM_VOICES];
+
+// Envelope used until told otherwise
+static EnvelopeParams const defaultEnvelope = {
+	.attackMs = 5,
+	.decayMs = 50,
+	.sustain = 200,
+	.releaseMs = 60,
+};
+
+// The envelope as set, and as per-sample steps for the interrupt
+static EnvelopeParams envelope;
+static volatile int32_t attackRate;
+static volatile int32_t decayRate;
+static volatile int32_t sustainLevel;
+static volatile int32_t releaseRate;
+
+// Step per sample to cover range in ms milliseconds
+static int32_t envelopeRate(uint16_t ms, int32_t range) {
+	int32_t samples = ms * (AUDIO_SAMPLE_RATE / 1000);
+	if (samples == 0) {
+		return range; // Instant
+	}
+	return max(range / samples, 1);
+}
+
+// Set the envelope used by all voices
+void synthEnvelopeSet(EnvelopeParams const *params) {
+	envelope = *params;
+	sustainLevel = (ENV_FULL / 255) * params->sustain;
+	attackRate = envelopeRate(params->attackMs, ENV_FULL);
+	decayRate = envelopeRate(params->decayMs, ENV_FULL - sustainLevel);
+	releaseRate = envelopeRate(params->releaseMs, ENV_FULL);
+}
+
+// Get the envelope used by all voices
+void synthEnvelopeGet(EnvelopeParams *params) {
+	*params = envelope;
+}
+
+// Phase increment for a frequency in Hz with 16 bits of fraction
+uint32_t synthIncrement(uint32_t hz) {
+	return (((uint64_t) hz) << 16) / AUDIO_SAMPLE_RATE;
+}
+
+// Start a note on voice v
+void synthNoteOn(int v, uint32_t increment) {
+	Voice *voice = voices + v;
+	voice->increment = increment;
+	voice->gate = true;
+	voice->trigger++;
+}
+
+// Change the pitch of voice v without retriggering its envelope
+void synthPitchSet(int v, uint32_t increment) {
+	voices[v].increment = increment;
+}
+
+// Release the note on voice v
+void synthNoteOff(int v) {
+	voices[v].gate = false;
+}
+
+// Release all voices
+void synthAllOff(void) {
+	for (int v = 0; v < NUM_VOICES; v++) {
+		synthNoteOff(v);
+	}
+}
+
+// Advance the envelope of a single voice and return its next sample.
+// Executes from within an interrupt
+static inline int32_t voiceNextSample(Voice *voice) {
+	// Note on restarts the attack from wherever the level is now
+	if (voice->trigger != voice->seenTrigger) {
+		voice->seenTrigger = voice->trigger;
+		voice->stage = ENV_ATTACK;
+	}
+	if (!voice->gate && voice->stage != ENV_IDLE) {
+		voice->stage = ENV_RELEASE;
+	}
+
+	switch (voice->stage) {
+		case ENV_IDLE:
+			return 0;
+		case ENV_ATTACK:
+			voice->level += attackRate;
+			if (voice->level >= ENV_FULL) {
+				voice->level = ENV_FULL;
+				voice->stage = ENV_DECAY;
+			}
+			break;
+		case ENV_DECAY:
+			voice->level -= decayRate;
+			if (voice->level <= sustainLevel) {
+				voice->level = sustainLevel;
+				voice->stage = ENV_SUSTAIN;
+			}
+			break;
+		case ENV_SUSTAIN:
+			break;
+		case ENV_RELEASE:
+			voice->level -= releaseRate;
+			if (voice->level <= 0) {
+				voice->level = 0;
+				voice->stage = ENV_IDLE;
+				return 0;
+			}
+			break;
+	}
+
+	voice->phase += voice->increment;
+	int32_t amplitude = voice->level >> ENV_SHIFT;
+	return (voice->phase & 0x80000000) ? amplitude : -amplitude;
+}
+
+// Advance all voices by one sample and return their sum. The saturate is
+// only a guard: ENV_SHIFT leaves room for every voice.
+// Executes from within an interrupt
+int32_t synthNextSample(void) {
+	int32_t sum = 0;
+	for (int v = 0; v < NUM_VOICES; v++) {
+		sum += voiceNextSample(voices + v);
+	}
+	return __SSAT(sum, 16);
+}
+
+// Start the synth with the default envelope
+void startSynth(void) {
+	synthEnvelopeSet(&defaultEnvelope);
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+// tune.c
+//
+// Streaming decoder for compact tunes.
+//
+// Tunes are byte streams generated by make_tables.py, which describes the
+// format. Each voice of a tune has its own stream. Most events are a single
+// byte holding an index into a small table of durations and the interval
+// from the previous note, and the short rest between notes is implied. The
+// reader decodes one event at a time straight from flash, so a tune costs
+// no SRAM.
+
+#include "decls.h"
+
+// Whether len bytes at tune are a tune the reader can play safely: every
+// voice lies within the tune, uses only its own durations and ends.
+bool tuneValidate(uint8_t const *tune, uint32_t len) {
+	if (len < 1 || tune[0] < 1 || tune[0] > TUNE_MAX_VOICES || len < 1 + 2 * tune[0]) {
+		return false;
+	}
+	for (int v = 0; v < tune[0]; v++) {
+		uint32_t i = tune[1 + 2 * v] | (tune[2 + 2 * v] << 8);
+		if (i >= len || i + 3 + tune[i] > len) {
+			return false;
+		}
+		uint8_t numDurations = tune[i];
+		i += 3 + numDurations;
+		for (;;) {
+			if (i >= len) {
+				return false;
+			}
+			uint8_t b = tune[i++];
+			if (b >> 4 != TUNE_ESCAPE) {
+				if ((b >> 4) >= numDurations) {
+					return false;
+				}
+			} else if ((b & 0xf) == TUNE_ESCAPE_LONG) {
+				i += 3;
+			} else if ((b & 0xf) == TUNE_ESCAPE_END) {
+				break;
+			} else {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+// Number of voices in a tune
+int tuneVoices(uint8_t const *tune) {
+	return min(tune[0], TUNE_MAX_VOICES);
+}
+
+// Start reading voice v of a tune
+void tuneReaderInit(TuneReader *r, uint8_t const *tune, int v) {
+	tune += tune[1 + 2 * v] | (tune[2 + 2 * v] << 8);
+	uint8_t numDurations = tune[0];
+	r->durations = tune + 1;
+	r->gap = tune[1 + numDurations];
+	r->previous = tune[2 + numDurations];
+	r->next = tune + 3 + numDurations;
+}
+
+// Read the next event. Returns false at the end of the tune.
+bool tuneReaderNext(TuneReader *r, TuneEvent *e) {
+	uint8_t b = *r->next++;
+	uint8_t code = b & 0xf;
+	if (b >> 4 == TUNE_ESCAPE) {
+		if (code != TUNE_ESCAPE_LONG) {
+			// End of tune, or not understood. Stay here.
+			r->next--;
+			return false;
+		}
+		e->note = r->next[0];
+		e->duration = r->next[1] | (r->next[2] << 8);
+		r->next += 3;
+	} else {
+		e->duration = r->durations[b >> 4];
+		e->note = code == TUNE_REST ? 0 :
+			noteTranspose(r->previous, code - TUNE_INTERVAL_ZERO);
+	}
+
+	if (e->note) {
+		r->previous = e->note;
+		e->gap = r->gap;
+	} else {
+		e->gap = 0;
+	}
+	return true;
+}
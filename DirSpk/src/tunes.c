@@ -6,126 +6,23 @@
 #include "decls.h"
 
 // Ode To Joy
-TuneData tune1[] = {
-  {0x4b, 0x0026},
-  {0x00, 0x0027},
-  {0x4b, 0x004d},
-  {0x00, 0x004e},
-  {0x50, 0x0074},
-  {0x00, 0x0075},
-  {0x52, 0x009b},
-  {0x00, 0x009c},
-  {0x52, 0x00c2},
-  {0x00, 0x00c3},
-  {0x50, 0x00e9},
-  {0x00, 0x00ea},
-  {0x4b, 0x0110},
-  {0x00, 0x0111},
-  {0x49, 0x0137},
-  {0x00, 0x0138},
-  {0x47, 0x015e},
-  {0x00, 0x015f},
-  {0x47, 0x0185},
-  {0x00, 0x0186},
-  {0x49, 0x01ac},
-  {0x00, 0x01ad},
-  {0x4b, 0x01d3},
-  {0x00, 0x01d4},
-  {0x4b, 0x020e},
-  {0x00, 0x020f},
-  {0x49, 0x0221},
-  {0x00, 0x0222},
-  {0x49, 0x026f},
-  {0x00, 0x0270},
-  {0x4b, 0x0297},
-  {0x00, 0x0298},
-  {0x4b, 0x02be},
-  {0x00, 0x02bf},
-  {0x50, 0x02e5},
-  {0x00, 0x02e6},
-  {0x52, 0x030c},
-  {0x00, 0x030d},
-  {0x52, 0x0333},
-  {0x00, 0x0334},
-  {0x50, 0x035a},
-  {0x00, 0x035b},
-  {0x4b, 0x0381},
-  {0x00, 0x0382},
-  {0x49, 0x03a8},
-  {0x00, 0x03a9},
-  {0x47, 0x03cf},
-  {0x00, 0x03d0},
-  {0x47, 0x03f6},
-  {0x00, 0x03f7},
-  {0x49, 0x041d},
-  {0x00, 0x041e},
-  {0x4b, 0x0444},
-  {0x00, 0x0445},
-  {0x49, 0x047f},
-  {0x00, 0x0480},
-  {0x47, 0x0492},
-  {0x00, 0x0493},
-  {0x47, 0x04e0},
-  {0x00, 0x04e1},
-  {0x49, 0x052f},
-  {0x00, 0x0530},
-  {0x4b, 0x0556},
-  {0x00, 0x0557},
-  {0x47, 0x057d},
-  {0x00, 0x057e},
-  {0x49, 0x05a4},
-  {0x00, 0x05a5},
-  {0x4b, 0x05b7},
-  {0x00, 0x05b8},
-  {0x50, 0x05cb},
-  {0x00, 0x05cc},
-  {0x4b, 0x05f2},
-  {0x00, 0x05f3},
-  {0x47, 0x0619},
-  {0x00, 0x061a},
-  {0x49, 0x0640},
-  {0x00, 0x0641},
-  {0x49, 0x0667},
-  {0x00, 0x0668},
-  {0x4b, 0x068e},
-  {0x00, 0x068f},
-  {0x49, 0x06b5},
-  {0x00, 0x06b6},
-  {0x47, 0x06f0},
-  {0x00, 0x06f1},
-  {0x49, 0x0703},
-  {0x00, 0x0704},
-  {0x52, 0x0751},
-  {0x00, 0x0752},
-  {0x4b, 0x0778},
-  {0x00, 0x0779},
-  {0x4b, 0x079f},
-  {0x00, 0x07a0},
-  {0x50, 0x07c6},
-  {0x00, 0x07c7},
-  {0x52, 0x07ee},
-  {0x00, 0x07ef},
-  {0x52, 0x0815},
-  {0x00, 0x0816},
-  {0x50, 0x083c},
-  {0x00, 0x083d},
-  {0x4b, 0x0863},
-  {0x00, 0x0864},
-  {0x49, 0x088a},
-  {0x00, 0x088b},
-  {0x47, 0x08b1},
-  {0x00, 0x08b2},
-  {0x47, 0x08d8},
-  {0x00, 0x08d9},
-  {0x49, 0x08ff},
-  {0x00, 0x0900},
-  {0x4b, 0x0926},
-  {0x00, 0x0927},
-  {0x49, 0x0961},
-  {0x00, 0x0962},
-  {0x47, 0x0974},
-  {0x00, 0x0975},
-  {0x47, 0x09c2},
-  {0x00, 0x09c3},
-  {0x00, 0xffff},
+// tuneData1: 74 bytes, was 484, saves 410
+uint8_t const tuneData1[] = {
+  0x01, 0x03, 0x00, 0x07, 0x26, 0x12, 0x3a, 0x4d, 0x27, 0x4e, 0x13, 0x01,
+  0x4b, 0x08, 0x08, 0x09, 0x0a, 0x08, 0x06, 0x07, 0x06, 0x06, 0x08, 0x0a,
+  0x0a, 0x28, 0x16, 0x38, 0x4a, 0x08, 0x09, 0x0a, 0x08, 0x06, 0x07, 0x06,
+  0x06, 0x08, 0x0a, 0x0a, 0x26, 0x16, 0x38, 0x5a, 0x0a, 0x04, 0x0a, 0x1a,
+  0x69, 0x07, 0x04, 0x0a, 0x08, 0x0a, 0x06, 0x26, 0x1a, 0x3d, 0x05, 0x08,
+  0x09, 0x4a, 0x08, 0x06, 0x07, 0x06, 0x06, 0x08, 0x0a, 0x0a, 0x26, 0x16,
+  0x38, 0xf0,
+};
+
+// Twinkle Twinkle Little Star
+// tuneData2: 52 bytes, was 340, saves 288
+uint8_t const tuneData2[] = {
+  0x01, 0x03, 0x00, 0x03, 0x26, 0x4d, 0x4e, 0x01, 0x40, 0x08, 0x08, 0x0f,
+  0x08, 0x0a, 0x08, 0x16, 0x06, 0x08, 0x07, 0x08, 0x06, 0x08, 0x26, 0x0f,
+  0x08, 0x06, 0x08, 0x07, 0x08, 0x16, 0x0d, 0x08, 0x06, 0x08, 0x07, 0x08,
+  0x26, 0x06, 0x08, 0x0f, 0x08, 0x0a, 0x08, 0x16, 0x06, 0x08, 0x07, 0x08,
+  0x06, 0x08, 0x26, 0xf0,
 };
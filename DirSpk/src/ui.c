@@ -73,33 +73,61 @@ static void updateGain(void) {
 }
 
 
-// Handled encoder moves
-static void uiHandleEncoderEvent(EncoderMove *p) {
+// Tempo change for one click of the tempo encoder
+#define UI_TEMPO_STEP (PLAYER_TEMPO_UNITY / 32)
+
+// While a tune plays, encoder 0 transposes and encoder 1 sets tempo
+static void uiHandleTuneEncoder(int num, int32_t delta) {
+	if (num == 0) {
+		int t = playerTransposeGet() + delta;
+		playerTransposeSet(min(max(t, -PLAYER_TRANSPOSE_MAX), PLAYER_TRANSPOSE_MAX));
+	} else if (num == 1) {
+		int t = playerTempoGet() + delta * UI_TEMPO_STEP;
+		playerTempoSet(min(max(t, PLAYER_TEMPO_MIN), PLAYER_TEMPO_MAX));
+	}
+}
+
+// Handle net moves of one encoder, clockwise positive. Volume and note
+// follow the accelerated moves.
+static void uiHandleEncoder(int num, int32_t delta, int32_t accelerated) {
 	// TODO: refit pots and re-instrument
-	if (uiMode == ModeGenerate) {
-		if (p->num == 0) {
-			if (p->dir == ENC_CW) {
+	if (uiMode == ModeGenerate &&
+			(generateSubMode == GenTune1 || generateSubMode == GenTune2)) {
+		uiHandleTuneEncoder(num, delta);
+	} else if (uiMode == ModeGenerate) {
+		if (num == 0) {
+			for (; accelerated > 0; accelerated--) {
 				note = noteIncrement(note);
-			} else {
+			}
+			for (; accelerated < 0; accelerated++) {
 				note = noteDecrement(note);
 			}
 		}
-		if (p->num == 1) {
-			if (volume > 0 && p->dir == ENC_CCW) {
-				volume--;
-			} else if ((volume < 255) & (p->dir == ENC_CW)) {
-				volume++;
-			}
+		if (num == 1) {
+			volume = min(max(volume + accelerated, 0), 255);
 		}
 	}
 	
 	// TODO: input mode
 	
 	// TODO: master + fade
-	// TODO: acceleration
 	// TODO: update NV pot after changes stop for a while
 }
 
+// Take encoder moves. Moves are counted in the encoder interrupt, so none
+// are lost however fast the encoders turn; the UI sees the net change.
+static void uiHandleEncoderEvent(void) {
+	int32_t deltas[NUM_ENCODERS], accelerated[NUM_ENCODERS];
+	if (!encoderTake(deltas, accelerated)) {
+		return;
+	}
+	for (int i = 0; i < NUM_ENCODERS; i++) {
+		if (deltas[i] || accelerated[i]) {
+			uiHandleEncoder(i, deltas[i], accelerated[i]);
+		}
+	}
+}
+
 // Handle the UI_TICK event
 static void uiHandleTickEvent(void) {
 	
@@ -112,12 +140,27 @@ static void uiHandleTickEvent(void) {
 			audioModeSet(AM_ADC);
 		}
 	} else if (uiMode == ModeInput) {
+		// Until there are real meters, show the loudest low and high bands
+		int8_t levels[SPECTRUM_BANDS];
+		spectrumGet(levels);
+		int8_t low = -SPECTRUM_FLOOR_DB, high = -SPECTRUM_FLOOR_DB;
+		for (int b = 0; b < SPECTRUM_BANDS; b++) {
+			if (b < SPECTRUM_BANDS / 2) {
+				low = max(low, levels[b]);
+			} else {
+				high = max(high, levels[b]);
+			}
+		}
+		AudioParams const *params = audioParams();
 		ScreenCommand input = {
 			.type = SCREEN_INPUT,
-			.leftLevel = 30,
-			.rightLevel = 70,
+			.leftLevel = low + SPECTRUM_FLOOR_DB,
+			.rightLevel = high + SPECTRUM_FLOOR_DB,
 			.gain = 23,
 			.fade = 50,
+			.gated = !audioGateIsOpen(),
+			.gateThresholdDb = params->gateThresholdDb,
+			.gateHoldMs = params->gateHoldSamples / (AUDIO_SAMPLE_RATE / 1000),
 		};
 		screenSendCommand(&input);
 	} else if (uiMode == ModeGenerate) {
@@ -135,10 +178,10 @@ static void uiHandleTickEvent(void) {
 		// TODO: either set mode and frequency here 
 		// OR change it with changing input.
 		if (generateSubMode == GenTone) {
-			audioModeSet(AM_HZ);
-			audioFrequencySet(noteToFrequency(note));
+			audioSet(AM_HZ, noteToFrequency(note), volume);
+		} else {
+			audioVolumeSet(volume);
 		}
-		audioVolume = volume;
 	}
 }
 
@@ -160,6 +203,7 @@ static void uiHandleGenerateTone(void) {
 		return;
 	}
 	generateSubMode = GenTone;
+	playerStop();
 }
 
 // Handle request to turn tune1 on
@@ -170,8 +214,8 @@ static void uiHandleGenerateTune1(void) {
 	}
 	generateSubMode = GenTune1;
 	audioModeSet(AM_HZ);
-	// Middle C - 261Hz
-	audioFrequencySet(noteToFrequency(0x40));
+	audioFrequencySet(0);
+	playerStart(tuneData1);
 }
 
 // Handle request to turn tune2 on
@@ -182,8 +226,8 @@ static void uiHandleGenerateTune2(void) {
 	}
 	generateSubMode = GenTune2;
 	audioModeSet(AM_HZ);
-	// 4 octaves above middle c - 4.186kHz
-	audioFrequencySet(noteToFrequency(0x80)); 
+	audioFrequencySet(0);
+	playerStart(tuneData2);
 }
 
 
@@ -222,7 +266,7 @@ static void getVolume(void) {
 // The ui coordinator task.
 static void uiTask(void *pvParameters) {
 	// TODO: verify 220, and change scaling in audio.c so 255 is the new max
-	audioVolume = 220; // Maximum usable volume, as it turns out
+	audioVolumeSet(220); // Maximum usable volume, as it turns out
 	
 	// Initialize the UI global state
 	spiWithMutex(getVolume);
@@ -244,9 +288,12 @@ static void uiTask(void *pvParameters) {
 			continue;
 		}
 		if (event.type == UI_ENCODER) {
-			uiHandleEncoderEvent(&event.encMove);
+			uiHandleEncoderEvent();
 		} else if (event.type == UI_TICK) {
+			// Also picks up moves if a UI_ENCODER event was lost to a full queue
+			uiHandleEncoderEvent();
 			uiHandleTickEvent();
+			encoderSaveTypes();
 		} else if (event.type == UI_GOTO_GENERATE) {
 			uiHandleGotoGenerate();
 		} else if (event.type == UI_GOTO_INPUT) {
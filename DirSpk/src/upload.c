@@ -0,0 +1,96 @@
+// upload.c
+//
+// Framed binary upload over the CLI UART.
+//
+// The host sends the data in frames, each answered with ACK or NAK, and
+// resends a frame on NAK or no answer. A resent frame that was already
+// taken, because its ACK was lost, is acknowledged again but not stored
+// twice. An END frame finishes the upload. CAN tells the host to stop, when
+// the data is refused or there are too many bad frames.
+//
+// Each frame is read with two calls to the UART driver, the header and then
+// everything else, rather than a byte at a time. The driver's receive
+// buffer holds a whole frame, so the host can send at the full line rate.
+
+#include "decls.h"
+
+// Time to wait for a frame to start, and then for the rest of it. The rest
+// takes under 25ms at 115200 baud, so a short read is answered with NAK
+// well before the host gives up waiting.
+#define UPLOAD_TIMEOUT_MS 2000
+#define UPLOAD_FRAME_TIMEOUT_MS 100
+
+// Bad frames allowed in one upload
+#define UPLOAD_MAX_ERRORS 16
+
+// Bytes around the payload: sync, sequence, type, length and CRC
+#define UPLOAD_HEADER 4
+#define UPLOAD_OVERHEAD (UPLOAD_HEADER + 2)
+
+// The frame being read
+static uint8_t frame[UPLOAD_FRAME_MAX + UPLOAD_OVERHEAD];
+
+// Read exactly n bytes. Returns false on timeout.
+static bool uploadRead(uint8_t *buf, uint32_t n, uint32_t timeoutMs) {
+	return freertos_uart_serial_read_packet(
+		freeRTOSUART, buf, n, MS_TO_TICKS(timeoutMs)) == n;
+}
+
+// Answer a frame
+static void uploadReply(uint8_t answer) {
+	// Must be written from RAM
+	static uint8_t reply;
+	reply = answer;
+	freertos_uart_write_packet(freeRTOSUART, &reply, 1, MS_TO_TICKS(UPLOAD_TIMEOUT_MS));
+}
+
+// Receive an upload, passing the data to sink as it arrives. Blocks the
+// calling task.
+UploadResult uploadReceive(UploadSink sink) {
+	uint8_t expected = 0;
+	int errors = 0;
+	for (;;) {
+		// Skip anything up to the start of a frame
+		do {
+			if (!uploadRead(frame, 1, UPLOAD_TIMEOUT_MS)) {
+				return UPLOAD_TIMEOUT;
+			}
+		} while (frame[0] != UPLOAD_SYNC);
+		
+		// A corrupt length can make the frame look longer than it is: then
+		// the read comes up short, and the frame is treated as bad
+		bool valid = uploadRead(frame + 1, UPLOAD_HEADER - 1, UPLOAD_FRAME_TIMEOUT_MS);
+		uint8_t sequence = frame[1];
+		uint8_t type = frame[2];
+		uint8_t n = frame[3];
+		valid = valid && uploadRead(frame + UPLOAD_HEADER, n + 2, UPLOAD_FRAME_TIMEOUT_MS);
+
+		uint16_t crc = frame[UPLOAD_HEADER + n] | (frame[UPLOAD_HEADER + n + 1] << 8);
+		valid = valid && crc16(0xffff, frame + 1, UPLOAD_HEADER - 1 + n) == crc &&
+			(type == UPLOAD_DATA || type == UPLOAD_END);
+		if (!valid) {
+			if (++errors > UPLOAD_MAX_ERRORS) {
+				uploadReply(UPLOAD_CAN);
+				return UPLOAD_BAD_FRAMES;
+			}
+			uploadReply(UPLOAD_NAK);
+			continue;
+		}
+		if (sequence != expected) {
+			// Already have this one
+			uploadReply(UPLOAD_ACK);
+			continue;
+		}
+
+		if (type == UPLOAD_END) {
+			uploadReply(UPLOAD_ACK);
+			return UPLOAD_OK;
+		}
+		if (!sink(frame + UPLOAD_HEADER, n)) {
+			uploadReply(UPLOAD_CAN);
+			return UPLOAD_REFUSED;
+		}
+		expected++;
+		uploadReply(UPLOAD_ACK);
+	}
+}
@@ -48,3 +48,14 @@ void fatalBlink(short longBlinks, short shortBlinks) {
 		errorBlink(longBlinks, shortBlinks);
 	}
 }
+
+// CRC-16/CCITT of len bytes, continuing from crc. Start with 0xffff.
+uint16_t crc16(uint16_t crc, uint8_t const *data, uint32_t len) {
+	for (uint32_t i = 0; i < len; i++) {
+		crc ^= data[i] << 8;
+		for (int b = 0; b < 8; b++) {
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+		}
+	}
+	return crc;
+}